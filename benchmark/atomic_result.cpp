@@ -0,0 +1,106 @@
+/* Benchmark of cross thread result publication latency by atomic_result versus a mutex and condition variable
+(C) 2026 agent <agent@local> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../include/outcome/atomic_result.hpp"
+#include "timing.h"
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <stdio.h>
+#include <thread>
+
+#define ITERATIONS 100000
+#define REPETITIONS 5
+
+// The traditional way of handing a result to another thread
+struct locked_result
+{
+  std::mutex lock;
+  std::condition_variable cond;
+  bool ready{false};
+  OUTCOME_V2_NAMESPACE::result<int> result{std::errc::invalid_argument};
+
+  void set_value(int v)
+  {
+    {
+      std::lock_guard<std::mutex> g(lock);
+      result = v;
+      ready = true;
+    }
+    cond.notify_all();
+  }
+  int wait()
+  {
+    std::unique_lock<std::mutex> g(lock);
+    cond.wait(g, [this] { return ready; });
+    return result.value();
+  }
+};
+
+struct atomic_result_adapter : OUTCOME_V2_NAMESPACE::atomic_result<int>
+{
+  int wait() { return OUTCOME_V2_NAMESPACE::atomic_result<int>::wait().value(); }
+};
+
+// Ping pong a counter between two threads, each publishing into a fresh slot
+template <class Slot> double run()
+{
+  double best = 1e300;
+  for(int r = 0; r < REPETITIONS; r++)
+  {
+    std::unique_ptr<Slot[]> pings(new Slot[ITERATIONS]), pongs(new Slot[ITERATIONS]);
+    std::thread ponger([&] {
+      for(int n = 0; n < ITERATIONS; n++)
+      {
+        pongs[n].set_value(pings[n].wait() + 1);
+      }
+    });
+    usCount start = GetUsCount();
+    int v = 0;
+    for(int n = 0; n < ITERATIONS; n++)
+    {
+      pings[n].set_value(v);
+      v = pongs[n].wait();
+    }
+    double ns = (GetUsCount() - start) / 1000.0 / ITERATIONS;
+    ponger.join();
+    if(v != ITERATIONS)
+    {
+      abort();
+    }
+    if(ns < best)
+    {
+      best = ns;
+    }
+  }
+  return best;
+}
+
+int main(void)
+{
+  printf("mutex + condvar ns per round trip,atomic_result ns per round trip\n");
+  printf("%f,%f\n", run<locked_result>(), run<atomic_result_adapter>());
+  return 0;
+}
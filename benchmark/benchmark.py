@@ -1,165 +1,297 @@
-#!/usr/bin/python
+#!/usr/bin/python3
 # Benchmark Outcome against other stuff
-# (C) 2017 Niall Douglas http://www.nedproductions.biz/
+# (C) 2017-2018 Niall Douglas http://www.nedproductions.biz/
 # Created: Mar 2017
+#
+# Usage: benchmark.py [--depths 1,10,100] [--configurations exception-throw,result] [--repetitions 5]
+#                     [--plot] [-- extra cmake configure args ...]
+# e.g.   benchmark.py --plot -- -DCMAKE_CXX_COMPILER=clang++-6.0
+#
+# Generates a chain of functions each in its own translation unit, each calling the next, for
+# each error handling configuration. These are built by CMake in Release, and then timed calling
+# into the chain at each depth, along the success path and along the failure path. Writes
+# results-<platform>.csv and, if --plot is given and matplotlib is installed, results-<platform>.png.
 
-from __future__ import print_function
-import sys, os, subprocess, shlex, time
+import sys, os, argparse, subprocess, shutil, tempfile, time
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..')
 
-class ErrorHandlingSystem(object):
-    "Base class for an error handling system"
 
-    def __init__(self):
-        pass
+class ErrorHandlingSystem(object):
+    "Base class for an error handling system, returning integers with negative values being failure"
+    exceptions = True
 
-    def preamble(self, idx):
+    def preamble(self):
         "Preamble written out before each source file"
         return ''
 
-    def function_cont(self, name):
-        "Function signature"
-        return 'extern int %s(int par)' % name
+    def return_type(self):
+        return 'int'
+
+    def function_cont(self, callee):
+        "Function implementation for every function but the final one"
+        return r'''{
+  RAII raii;
+  int v = %s(par + 1);
+  if(v < 0)
+  {
+    return v;
+  }
+  return v + 1;
+}
+''' % callee
 
     def function_final(self):
         "Function implementation for final function zero"
-        return r'''{ return par ? -1 : 0; }'''
-
-    def generate_sources(self, no):
-        "Generate no source files calling into one another"
-        for n in xrange(0, no):
-            with open("source%04d.cpp" % n, 'wt') as oh:
-                oh.write(self.preamble(n))
-                oh.write(r'''extern volatile int counter;
+        return r'''{
+  if(fail)
+  {
+    return -1;
+  }
+  return par;
+}
+'''
+
+    def generate_sources(self, path, no):
+        "Generate no source files calling into one another into path"
+        decl = 'extern %s funct%%04d(int par)' % self.return_type()
+        for n in range(no):
+            with open(os.path.join(path, 'source%04d.cpp' % n), 'wt') as oh:
+                oh.write(self.preamble())
+                oh.write(r'''extern volatile int counter, fail;
 struct RAII { RAII() { ++counter; } ~RAII() { --counter; } };
 ''')
                 if n:
-                    oh.write(self.function_cont("funct%04d" % (n-1)) + ';\n')
-                oh.write(self.function_cont("funct%04d" % n))
-                if n:
-                    oh.write(r'''
-{
+                    oh.write(decl % (n - 1) + ';\n')
+                oh.write(decl % n + '\n')
+                oh.write(self.function_cont('funct%04d' % (n - 1)) if n else self.function_final())
+        with open(os.path.join(path, 'function.h'), 'wt') as oh:
+            oh.write(self.preamble())
+            oh.write('typedef %s (*function_type)(int);\n' % self.return_type())
+            oh.write('extern const function_type function_table[];\n')
+            oh.write('#define FUNCTIONS %d\n' % no)
+        with open(os.path.join(path, 'table.cpp'), 'wt') as oh:
+            oh.write('#include "function.h"\n')
+            for n in range(no):
+                oh.write(decl % n + ';\n')
+            oh.write('extern const function_type function_table[] = {\n')
+            for n in range(no):
+                oh.write('  funct%04d,\n' % n)
+            oh.write('};\n')
+
+
+class ExceptionThrow(ErrorHandlingSystem):
+    def preamble(self):
+        return '#include <exception>\n'
+
+    def function_cont(self, callee):
+        return r'''{
   RAII raii;
-  return ''' + ("funct%04d" % (n-1)) + r'''(par + 1);
+  return %s(par + 1) + 1;
 }
-''')
-                else:
-                    oh.write(self.function_final())
-        with open("function.h", 'wt') as oh:
-            oh.write(self.function_cont("funct%04d" % (no-1)) + ';\n')
-            oh.write("#define FUNCTION funct%04d\n" % (no-1))
-            oh.write("#define NESTING %d\n" % (no))
+''' % callee
 
-class ExceptionThrow(ErrorHandlingSystem):
-    def preamble(self, idx):
-        return '#include <exception>\n' if idx == 0 else ''
     def function_final(self):
-        return r'''{ throw std::exception(); }'''
+        return r'''{
+  if(fail)
+  {
+    throw std::exception();
+  }
+  return par;
+}
+'''
 
-class ResultErrorValue(ErrorHandlingSystem):
-    def preamble(self, idx):
-        return '#include "../include/outcome/result.hpp"\n'
-    def function_cont(self, name):
-        return 'extern OUTCOME_V2_NAMESPACE::result<int> %s(int par)' % name
-    def function_final(self):
-        return r'''{ return par; }'''
 
-class ResultErrorError(ResultErrorValue):
-    def function_final(self):
-        return r'''{ return std::error_code(5, std::generic_category()); }'''
+class Result(ErrorHandlingSystem):
+    def preamble(self):
+        return '#include "outcome/result.hpp"\n#include "outcome/try.hpp"\n'
+
+    def return_type(self):
+        return 'OUTCOME_V2_NAMESPACE::result<int>'
+
+    def function_cont(self, callee):
+        return r'''{
+  RAII raii;
+  OUTCOME_TRY(v, %s(par + 1));
+  return v + 1;
+}
+''' % callee
 
-class ResultExceptionValue(ResultErrorValue):
-    def function_cont(self, name):
-        return 'extern OUTCOME_V2_NAMESPACE::result<int, std::exception_ptr> %s(int par)' % name
-    def function_final(self):
-        return r'''{ return par; }'''
-        
-class ResultExceptionError(ResultExceptionValue):
-    def function_cont(self, name):
-        return 'extern OUTCOME_V2_NAMESPACE::result<int, std::exception_ptr> %s(int par)' % name
     def function_final(self):
-        return r'''{ return std::make_exception_ptr(std::exception()); }'''
-        
+        return r'''{
+  if(fail)
+  {
+    return std::error_code(EINVAL, std::generic_category());
+  }
+  return par;
+}
+'''
+
+
+class ResultNoExcept(Result):
+    exceptions = False
+
+
+class Outcome(Result):
+    def preamble(self):
+        return '#include "outcome/outcome.hpp"\n#include "outcome/try.hpp"\n'
+
+    def return_type(self):
+        return 'OUTCOME_V2_NAMESPACE::outcome<int>'
+
+
+class OutcomeHooks(Outcome):
+    "An outcome whose construction hooks record how many times one was constructed into its spare storage"
+
+    def preamble(self):
+        return Outcome.preamble(self) + r'''#ifndef HOOKED_OUTCOME
+#define HOOKED_OUTCOME
+namespace hooked
+{
+  // A local error code type makes ADL look in this namespace for the hooks
+  struct error_code : public std::error_code
+  {
+    using std::error_code::error_code;
+    error_code() = default;
+    error_code(std::error_code ec)
+    : std::error_code(ec)
+    {
+    }
+  };
+  template <class T> using outcome = OUTCOME_V2_NAMESPACE::outcome<T, error_code>;
+  extern volatile unsigned short constructions;
+  template <class T> inline void count(outcome<T> *o) noexcept { OUTCOME_V2_NAMESPACE::hooks::set_spare_storage(o, constructions = constructions + 1); }
+  template <class T, class U> inline void hook_outcome_construction(outcome<T> *o, U && /*unused*/) noexcept { count(o); }
+  template <class T, class U> inline void hook_outcome_copy_construction(outcome<T> *o, U && /*unused*/) noexcept { count(o); }
+  template <class T, class U> inline void hook_outcome_move_construction(outcome<T> *o, U && /*unused*/) noexcept { count(o); }
+}
+#endif
+'''
+
+    def return_type(self):
+        return 'hooked::outcome<int>'
+
+    def generate_sources(self, path, no):
+        Outcome.generate_sources(self, path, no)
+        with open(os.path.join(path, 'table.cpp'), 'at') as oh:
+            oh.write('volatile unsigned short hooked::constructions;\n')
+
+
 matrix = [
     ('integer-returns', ErrorHandlingSystem),
     ('exception-throw', ExceptionThrow),
-    ('result-error-value', ResultErrorValue),
-    ('result-error-error', ResultErrorError),
-    ('result-excpt-value', ResultExceptionValue),
-    ('result-excpt-error', ResultExceptionError),
+    ('result', Result),
+    ('result-noexcept', ResultNoExcept),
+    ('outcome', Outcome),
+    ('outcome-hooks', OutcomeHooks),
 ]
 
-if sys.platform == 'win32':
-    compilers = [
-        ('msvc1912-noexcept', r'cl /nologo /std:c++latest /O2 /Gy /MD /Fe%s /I..\\..'),
-        ('msvc1912', r'cl /nologo /std:c++latest /O2 /Gy /MD /EHsc /Fe%s /I..\\..'),
-        ('msvc1912-ltcg', r'cl /nologo /std:c++latest /O2 /Gy /GL /MD /EHsc /Fe%s /I..\\..'),
-    ]
-elif sys.platform == 'darwin':
-    compilers = [
-        ('xcode82', r'clang++ -std=c++14 -O3 -g -o %s'),
-    ]
-else:
-    compilers = [
-        ('gcc72-noexcept', r'g++-7 -std=c++17 -fno-exceptions -O3 -g -o %s -I../..'),
-        ('gcc72', r'g++-7 -std=c++17 -O3 -g -o %s -I../..'),
-        ('gcc72-lto', r'g++-7 -std=c++17 -O3 -g -flto -o %s -I../..'),
-        ('clang50', r'clang++-5.0 -std=c++17 -O3 -g -o %s -I../..'),
-#        ('clang40-lto', r'clang++-4.0 -std=c++14 -O3 -g -flto -o %s'),  not working yet
-    ]
-
-SOURCES=10
-if len(sys.argv)>1:
-    SOURCES = int(sys.argv[1])
-
-with open('results-'+sys.platform+'.csv', 'wt') as resultsh:
-    resultsh.write('"Compiler"')
-    for m in matrix:
-        resultsh.write(',"'+m[0]+'"')
-    resultsh.write('\n')
-    for compiler in compilers:
-        resultsh.write('"'+compiler[0]+'"')
-        for m in matrix:
-            if 'noexcept' in compiler[0] and m[0] == 'exception-throw':
-                resultsh.write(',')
-                continue
-            instance = m[1]()
-            try:
-                exename = m[0]+'_'+compiler[0]
-                print("\nGenerating sources for", exename, "...")
-                instance.generate_sources(SOURCES)
-                args = shlex.split(compiler[1] % exename)
-                args.append("runner.cpp")
-                for n in xrange(0, SOURCES):
-                    args.append("source%04d.cpp" % n)
-                if sys.platform == 'win32':
-                    args.append("/link")
-                    args.append("/OPT:REF,ICF")
-                #print(' '.join(args))
-                try:
-                    print("Compiling", exename, "...")
-                    compile_begin = time.clock()
-                    print(subprocess.check_output(args))
-                    compile_end = time.clock()
-                    print("Compile took", compile_end-compile_begin, "secs. Running executable ...")
-                except subprocess.CalledProcessError as e:
-                    print(e.output)
-                    raise
-            finally:
-                for n in xrange(0, SOURCES):
-                    if os.path.exists("source%04d.cpp" % n):
-                        os.remove("source%04d.cpp" % n)
-                    if os.path.exists("source%04d.obj" % n):
-                        os.remove("source%04d.obj" % n)
-                os.remove("function.h")
-                #if os.path.exists(exename):
-                #    os.remove(exename)
-                #if os.path.exists(exename+'.exe'):
-                #    os.remove(exename+'.exe')
-                if os.path.exists("runner.obj"):
-                    os.remove("runner.obj")
-            if sys.platform != 'win32':
-                exename = './' + exename
-            result = subprocess.check_output([exename])
-            resultsh.write(',' + result.rstrip())
-            resultsh.flush()
-        resultsh.write('\n')
+cmakelists = r'''cmake_minimum_required(VERSION 3.5)
+project(outcome-benchmark CXX)
+if(NOT CMAKE_BUILD_TYPE)
+  set(CMAKE_BUILD_TYPE Release)
+endif()
+set(CMAKE_CXX_STANDARD 14)
+include_directories("%(include)s" "%(benchmark)s")
+foreach(configuration %(configurations)s)
+  file(GLOB sources "${CMAKE_CURRENT_SOURCE_DIR}/${configuration}/*.cpp")
+  add_executable(${configuration} "%(benchmark)s/runner.cpp" ${sources})
+  target_include_directories(${configuration} PRIVATE "${CMAKE_CURRENT_SOURCE_DIR}/${configuration}")
+endforeach()
+foreach(configuration %(noexcept)s)
+  if(MSVC)
+    target_compile_options(${configuration} PRIVATE /EHs-c- /D_HAS_EXCEPTIONS=0)
+  else()
+    target_compile_options(${configuration} PRIVATE -fno-exceptions)
+  endif()
+endforeach()
+'''
+
+
+def cmake_path(path):
+    return os.path.abspath(path).replace('\\', '/')
+
+
+def executable(builddir, name):
+    for candidate in (os.path.join(builddir, name), os.path.join(builddir, 'Release', name + '.exe'), os.path.join(builddir, name + '.exe')):
+        if os.path.exists(candidate):
+            return candidate
+    raise RuntimeError('Could not find the executable for ' + name)
+
+
+def plot(rows, path):
+    try:
+        import matplotlib
+        matplotlib.use('Agg')
+        import matplotlib.pyplot as plt
+    except ImportError:
+        print('matplotlib is not installed, so not plotting', file=sys.stderr)
+        return
+    fig, axes = plt.subplots(1, 2, figsize=(14, 6))
+    for idx, title in ((0, 'Success'), (1, 'Failure')):
+        for name, _ in matrix:
+            points = [(r[1], r[2 + idx]) for r in rows if r[0] == name]
+            if points:
+                axes[idx].plot([p[0] for p in points], [p[1] for p in points], marker='o', label=name)
+        axes[idx].set_xscale('log')
+        axes[idx].set_yscale('log')
+        axes[idx].set_xlabel('Depth of call chain')
+        axes[idx].set_ylabel('Nanoseconds per call')
+        axes[idx].set_title(title)
+        axes[idx].grid(True, which='both', alpha=0.3)
+        axes[idx].legend()
+    fig.tight_layout()
+    fig.savefig(path)
+
+
+parser = argparse.ArgumentParser(description='Benchmark the cost of returning through a chain of functions using various error handling systems')
+parser.add_argument('--depths', default='1,2,5,10,20,50,100,200,500,1000,2000,5000', help='comma separated depths of call chain to time')
+parser.add_argument('--configurations', default=','.join(m[0] for m in matrix), help='comma separated configurations to build')
+parser.add_argument('--repetitions', type=int, default=5, help='timings to take at each depth, of which the best is reported')
+parser.add_argument('--plot', action='store_true', help='also plot the results with matplotlib')
+parser.add_argument('--keep', action='store_true', help='do not delete the generated project afterwards')
+parser.add_argument('cmake_args', nargs='*', help='extra arguments for the cmake configure')
+args = parser.parse_args()
+depths = sorted(int(d) for d in args.depths.split(','))
+configurations = [m for m in matrix if m[0] in args.configurations.split(',')]
+
+workdir = tempfile.mkdtemp(prefix='outcome_benchmark_')
+try:
+    for name, system in configurations:
+        print('Generating sources for', name, '...', file=sys.stderr)
+        os.mkdir(os.path.join(workdir, name))
+        system().generate_sources(os.path.join(workdir, name), depths[-1])
+    with open(os.path.join(workdir, 'CMakeLists.txt'), 'wt') as oh:
+        oh.write(cmakelists % {
+            'include': cmake_path(os.path.join(ROOT, 'include')),
+            'benchmark': cmake_path(os.path.join(ROOT, 'benchmark')),
+            'configurations': ' '.join(m[0] for m in configurations),
+            'noexcept': ' '.join(m[0] for m in configurations if not m[1].exceptions),
+        })
+    builddir = os.path.join(workdir, 'build')
+    print('Configuring ...', file=sys.stderr)
+    subprocess.check_call(['cmake', '-S', workdir, '-B', builddir, '-DCMAKE_BUILD_TYPE=Release'] + args.cmake_args, stdout=sys.stderr)
+    print('Building ...', file=sys.stderr)
+    begin = time.perf_counter()
+    subprocess.check_call(['cmake', '--build', builddir, '--config', 'Release', '--parallel', str(os.cpu_count())], stdout=sys.stderr)
+    print('Building took', time.perf_counter() - begin, 'secs', file=sys.stderr)
+
+    rows = []
+    for name, _ in configurations:
+        print('Running', name, '...', file=sys.stderr)
+        output = subprocess.check_output([executable(builddir, name), str(args.repetitions)] + [str(d) for d in depths]).decode()
+        for line in output.splitlines()[1:]:
+            depth, success, failure = line.split(',')
+            rows.append((name, int(depth), float(success), float(failure)))
+
+    with open('results-' + sys.platform + '.csv', 'wt') as resultsh:
+        resultsh.write('"Configuration","Depth","Success ns per call","Failure ns per call"\n')
+        for row in rows:
+            resultsh.write('"%s",%d,%f,%f\n' % row)
+    if args.plot:
+        plot(rows, 'results-' + sys.platform + '.png')
+finally:
+    if args.keep:
+        print('Generated project left in', workdir, file=sys.stderr)
+    else:
+        shutil.rmtree(workdir)
@@ -0,0 +1,138 @@
+/* Benchmark of binary error code encoding by stable category id versus by category name
+(C) 2026 agent <agent@local> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../include/outcome/category_registry.hpp"
+#include "timing.h"
+
+#include <memory>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#define ITERATIONS 10000000
+#define REPETITIONS 5
+#define CATEGORIES 16
+
+class named_category : public std::error_category
+{
+  char _name[32];
+
+public:
+  explicit named_category(int n) { snprintf(_name, sizeof(_name), "benchmark_category_%d", n); }
+  const char *name() const noexcept override { return _name; }
+  std::string message(int /*unused*/) const override { return _name; }
+};
+static std::vector<std::unique_ptr<named_category>> categories;
+static std::vector<std::error_code> codes;
+
+// The alternative without a registry: send the category name, and decode by searching the known categories
+static size_t encode_by_name(const std::error_code &ec, char *buffer)
+{
+  const char *name = ec.category().name();
+  const size_t len = strlen(name);
+  memcpy(buffer, name, len + 1);
+  const int v = ec.value();
+  memcpy(buffer + len + 1, &v, sizeof(v));
+  return len + 1 + sizeof(v);
+}
+static std::error_code decode_by_name(const char *buffer)
+{
+  int v;
+  memcpy(&v, buffer + strlen(buffer) + 1, sizeof(v));
+  for(auto &c : categories)
+  {
+    if(strcmp(c->name(), buffer) == 0)
+    {
+      return {v, *c};
+    }
+  }
+  return {v, std::generic_category()};
+}
+
+static size_t encode_by_id(const std::error_code &ec, char *buffer)
+{
+  OUTCOME_V2_NAMESPACE::encode_error_code(ec).value().write(buffer);
+  return OUTCOME_V2_NAMESPACE::encoded_error_code::bytes;
+}
+static std::error_code decode_by_id(const char *buffer)
+{
+  return OUTCOME_V2_NAMESPACE::decode_error_code(OUTCOME_V2_NAMESPACE::encoded_error_code::read(buffer));
+}
+
+template <size_t (*Encode)(const std::error_code &, char *), std::error_code (*Decode)(const char *)> void run(double &encode_ns, double &decode_ns)
+{
+  std::vector<char> buffer(ITERATIONS / 16 * 64);
+  std::vector<size_t> offsets(ITERATIONS / 16);
+  encode_ns = decode_ns = 1e300;
+  for(int r = 0; r < REPETITIONS; r++)
+  {
+    size_t offset = 0;
+    usCount start = GetUsCount();
+    for(size_t n = 0; n < offsets.size(); n++)
+    {
+      offsets[n] = offset;
+      offset += Encode(codes[n % CATEGORIES], buffer.data() + offset);
+    }
+    double ns = (GetUsCount() - start) / 1000.0 / offsets.size();
+    if(ns < encode_ns)
+    {
+      encode_ns = ns;
+    }
+    size_t matched = 0;
+    start = GetUsCount();
+    for(size_t n = 0; n < offsets.size(); n++)
+    {
+      matched += (Decode(buffer.data() + offsets[n]) == codes[n % CATEGORIES]) ? 1 : 0;
+    }
+    ns = (GetUsCount() - start) / 1000.0 / offsets.size();
+    if(matched != offsets.size())
+    {
+      abort();
+    }
+    if(ns < decode_ns)
+    {
+      decode_ns = ns;
+    }
+  }
+}
+
+int main(void)
+{
+  for(int n = 0; n < CATEGORIES; n++)
+  {
+    categories.emplace_back(new named_category(n));
+    if(!OUTCOME_V2_NAMESPACE::register_category(*categories.back()))
+    {
+      abort();
+    }
+    codes.emplace_back(n, *categories.back());
+  }
+  double encode_by_name_ns, decode_by_name_ns, encode_by_id_ns, decode_by_id_ns;
+  run<encode_by_name, decode_by_name>(encode_by_name_ns, decode_by_name_ns);
+  run<encode_by_id, decode_by_id>(encode_by_id_ns, decode_by_id_ns);
+  printf("operation,by category name ns,by stable category id ns\n");
+  printf("encode,%f,%f\n", encode_by_name_ns, encode_by_id_ns);
+  printf("decode,%f,%f\n", decode_by_name_ns, decode_by_id_ns);
+  return 0;
+}
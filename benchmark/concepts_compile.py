@@ -0,0 +1,87 @@
+#!/usr/bin/python3
+# Benchmark the compiler's time and memory for a translation unit instantiating many distinct results,
+# using the SFINAE predicates versus the C++ 20 Concepts predicates and storage selection
+# (C) 2026 agent agent@local
+# Created: Oct 2026
+#
+# Usage: concepts_compile.py [distinct types] [compiler] [extra compiler args ...]
+# e.g.   concepts_compile.py 200 g++-10 -I../../quickcpplib
+#
+# Writes a CSV of the best of three compiles' wall clock seconds and peak compiler memory to stdout.
+
+import sys, os, subprocess, tempfile, time
+
+TYPES = int(sys.argv[1]) if len(sys.argv) > 1 else 200
+COMPILER = sys.argv[2] if len(sys.argv) > 2 else 'g++'
+EXTRA_ARGS = sys.argv[3:]
+INCLUDE = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'include')
+REPEATS = 3
+
+def source():
+    "A translation unit which constructs, copies, moves and observes results and outcomes of many distinct types"
+    out = '#include "outcome.hpp"\n#include <string>\n#include <memory>\nnamespace outcome = OUTCOME_V2_NAMESPACE;\n'
+    for n in range(TYPES):
+        # A third each of trivial, non-trivial, and move only types, so each kind of storage is selected
+        member = ('int', 'std::string', 'std::unique_ptr<int>')[n % 3]
+        out += r'''
+struct udt%(n)d
+{
+  %(member)s v;
+  udt%(n)d() = default;
+  explicit udt%(n)d(int) {}
+};
+outcome::result<udt%(n)d> make%(n)d(int x)
+{
+  if(x < 0)
+  {
+    return std::errc::invalid_argument;
+  }
+  outcome::result<udt%(n)d> r(outcome::in_place_type<udt%(n)d>, x), s(std::move(r));
+  r = std::move(s);
+  return r;
+}
+outcome::outcome<udt%(n)d> wrap%(n)d(int x)
+{
+  OUTCOME_TRY(v, make%(n)d(x));
+  if(x == 1)
+  {
+    return std::make_exception_ptr(std::runtime_error("one"));
+  }
+  return outcome::success(std::move(v));
+}
+bool test%(n)d(int x)
+{
+  auto r = wrap%(n)d(x);
+  return r.has_value() && !r.has_error();
+}
+''' % {'n': n, 'member': member}
+    return out
+
+def compile_once(args):
+    "Compile, returning wall clock seconds and peak resident memory in Mb, or None if the compile failed"
+    begin = time.perf_counter()
+    child = subprocess.Popen(args, stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
+    output = child.stdout.read()
+    _, status, usage = os.wait4(child.pid, 0)
+    end = time.perf_counter()
+    if status != 0:
+        sys.stderr.write(output.decode(errors='replace')[:4000])
+        return None
+    return end - begin, usage.ru_maxrss / 1024.0
+
+fd, path = tempfile.mkstemp(suffix='.cpp', prefix='outcome_concepts_compile_')
+try:
+    with os.fdopen(fd, 'wt') as oh:
+        oh.write(source())
+    print('"Mode","Distinct types","Seconds","Peak compiler Mb"')
+    for mode, flags in (('C++ 17 SFINAE', ['-std=c++17']),
+                        ('C++ 20 SFINAE', ['-std=c++20', '-DOUTCOME_USE_CXX20_CONCEPTS=0']),
+                        ('C++ 20 Concepts', ['-std=c++20'])):
+        args = [COMPILER] + flags + ['-O0', '-I' + INCLUDE] + EXTRA_ARGS + ['-c', path, '-o', os.devnull]
+        results = [compile_once(args) for n in range(REPEATS)]
+        if None in results:
+            print('"%s",%d,,' % (mode, TYPES))
+        else:
+            print('"%s",%d,%f,%f' % (mode, TYPES, min(r[0] for r in results), min(r[1] for r in results)))
+finally:
+    os.remove(path)
@@ -0,0 +1,125 @@
+/* Benchmark of the per call cost of the state observers in unoptimised debug builds
+(C) 2026 agent <agent@local> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/* Build this with -O0 or -Og, once as usual and once with -DOUTCOME_FORCEINLINE= to see what
+always inlining the trivial observers saves debug builds.
+*/
+
+#include "../include/outcome.hpp"
+#include "timing.h"
+
+#include <stdio.h>
+#include <vector>
+
+#define ITERATIONS 1000
+#define REPETITIONS 5
+#define ITEMS 10000
+
+namespace outcome = OUTCOME_V2_NAMESPACE;
+
+// What people write without Outcome
+struct plain
+{
+  int value;
+  int error;
+  bool has_value() const { return error == 0; }
+};
+
+template <class F> double run(F &&f)
+{
+  double best = 1e300;
+  for(int r = 0; r < REPETITIONS; r++)
+  {
+    usCount start = GetUsCount();
+    for(int n = 0; n < ITERATIONS; n++)
+    {
+      f();
+    }
+    double ns = (GetUsCount() - start) / 1000.0 / ITERATIONS / ITEMS;
+    if(ns < best)
+    {
+      best = ns;
+    }
+  }
+  return best;
+}
+
+int main(void)
+{
+  std::vector<plain> plains;
+  std::vector<outcome::result<int>> results;
+  std::vector<outcome::outcome<int>> outcomes;
+  for(int n = 0; n < ITEMS; n++)
+  {
+    if(n % 4 == 0)
+    {
+      plains.push_back(plain{0, EINVAL});
+      results.push_back(std::errc::invalid_argument);
+      outcomes.push_back(std::errc::invalid_argument);
+    }
+    else
+    {
+      plains.push_back(plain{n, 0});
+      results.push_back(n);
+      outcomes.push_back(n);
+    }
+  }
+  volatile long sink = 0;
+  double p = run([&] {
+    long total = 0;
+    for(const auto &i : plains)
+    {
+      total += i.has_value() ? i.value : i.error;
+    }
+    sink = total;
+  });
+  double r = run([&] {
+    long total = 0;
+    for(const auto &i : results)
+    {
+      total += i.has_value() ? i.assume_value() : i.assume_error().value();
+    }
+    sink = total;
+  });
+  double rw = run([&] {
+    long total = 0;
+    for(const auto &i : results)
+    {
+      total += i ? i.value() : i.error().value();
+    }
+    sink = total;
+  });
+  double o = run([&] {
+    long total = 0;
+    for(const auto &i : outcomes)
+    {
+      total += (i.has_value() && !i.has_exception()) ? i.assume_value() : i.assume_error().value();
+    }
+    sink = total;
+  });
+  (void) sink;
+  printf("plain struct ns per item,result narrow ns per item,result wide ns per item,outcome narrow ns per item\n");
+  printf("%f,%f,%f,%f\n", p, r, rw, o);
+  return 0;
+}
@@ -0,0 +1,96 @@
+/* Benchmark of reusing a result slot in a loop by assignment from a temporary versus by emplacement
+(C) 2026 agent <agent@local> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../include/outcome/result.hpp"
+#include "timing.h"
+
+#include <stdio.h>
+#include <string>
+
+#define ITERATIONS 10000000
+#define REPETITIONS 5
+
+using result_type = OUTCOME_V2_NAMESPACE::result<std::string>;
+
+// Every eighth item fails, as a parser reusing one result per item might
+static volatile unsigned fail_mask = 7;
+static const char *const text = "a short string";
+
+QUICKCPPLIB_NOINLINE void assign(result_type &r, unsigned n)
+{
+  if((n & fail_mask) == 0)
+  {
+    r = result_type(std::errc::invalid_argument);
+  }
+  else
+  {
+    r = result_type(OUTCOME_V2_NAMESPACE::in_place_type<std::string>, text);
+  }
+}
+
+QUICKCPPLIB_NOINLINE void emplace(result_type &r, unsigned n)
+{
+  if((n & fail_mask) == 0)
+  {
+    r.emplace_error(std::make_error_code(std::errc::invalid_argument));
+  }
+  else
+  {
+    r.emplace_value(text);
+  }
+}
+
+template <class F> double run(F &&f)
+{
+  double best = 1e300;
+  for(int r = 0; r < REPETITIONS; r++)
+  {
+    result_type slot(std::errc::invalid_argument);
+    size_t total = 0;
+    usCount start = GetUsCount();
+    for(unsigned n = 0; n < ITERATIONS; n++)
+    {
+      f(slot, n);
+      total += slot ? slot.assume_value().size() : 0;
+    }
+    double ns = (GetUsCount() - start) / 1000.0 / ITERATIONS;
+    if(total == 0)
+    {
+      abort();
+    }
+    if(ns < best)
+    {
+      best = ns;
+    }
+  }
+  return best;
+}
+
+int main(void)
+{
+  printf("method,ns per reuse\n");
+  printf("assignment,%f\n", run(assign));
+  printf("emplacement,%f\n", run(emplace));
+  return 0;
+}
@@ -0,0 +1,103 @@
+#!/usr/bin/python3
+# Benchmark compile times and object sizes with and without the extern templates of outcome_inst
+# (C) 2026 agent agent@local
+# Created: Oct 2026
+#
+# Usage: extern_templates.py [translation units] [compiler] [extra compiler args ...]
+# e.g.   extern_templates.py 1000 g++-7 -I../../quickcpplib
+#
+# Writes a CSV of total wall clock seconds to compile, and total bytes of object code before and
+# after linking into a shared library, to stdout.
+
+import sys, os, subprocess, shutil, tempfile, time
+from concurrent.futures import ThreadPoolExecutor
+
+TUS = int(sys.argv[1]) if len(sys.argv) > 1 else 1000
+COMPILER = sys.argv[2] if len(sys.argv) > 2 else 'g++'
+EXTRA_ARGS = sys.argv[3:]
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..')
+INCLUDE = os.path.join(ROOT, 'include')
+
+def source(n, preamble):
+    "A translation unit which uses each of the default extern template specialisations"
+    return '#include <string>\n#include "outcome.hpp"\n' + preamble + r'''
+namespace outcome = OUTCOME_V2_NAMESPACE;
+extern outcome::result<int> tu%(p)04d_parse(const char *s);
+outcome::result<int> tu%(n)04d_parse(const char *s)
+{
+  if(s == nullptr)
+  {
+    return std::errc::invalid_argument;
+  }
+  return static_cast<int>(*s) + %(n)d;
+}
+outcome::result<void> tu%(n)04d_check(const char *s)
+{
+  OUTCOME_TRY(v, tu%(p)04d_parse(s));
+  if(v < 0)
+  {
+    return std::errc::result_out_of_range;
+  }
+  return outcome::success();
+}
+outcome::result<std::string> tu%(n)04d_name(const char *s)
+{
+  OUTCOME_TRYV(tu%(n)04d_check(s));
+  return std::string(s);
+}
+outcome::outcome<void> tu%(n)04d_run(const char *s)
+{
+  OUTCOME_TRY(v, tu%(n)04d_name(s));
+  if(v.empty())
+  {
+    return std::make_exception_ptr(std::invalid_argument("empty"));
+  }
+  return outcome::success();
+}
+''' % {'n': n, 'p': max(n - 1, 0)}
+
+def run_all(commands, cwd):
+    "Run each command, all processors in parallel, returning wall clock seconds"
+    def run_one(args):
+        return subprocess.run(args, cwd=cwd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
+    begin = time.perf_counter()
+    with ThreadPoolExecutor(os.cpu_count()) as pool:
+        results = list(pool.map(run_one, commands))
+    end = time.perf_counter()
+    for r in results:
+        if r.returncode != 0:
+            sys.stderr.write(r.stdout.decode(errors='replace')[:4000])
+            return None
+    return end - begin
+
+def text_bytes(objects, cwd):
+    "The total size of the code and data in the objects, as reported by size"
+    out = subprocess.check_output(['size'] + objects, cwd=cwd).decode().splitlines()[1:]
+    return sum(int(line.split()[3]) for line in out)
+
+workdir = tempfile.mkdtemp(prefix='outcome_extern_templates_')
+try:
+    print('"Mode","Optimisation","Translation units","Total seconds","Seconds per translation unit","Object bytes","outcome_inst bytes","Linked bytes"')
+    for opt in ('-O0', '-O2'):
+        args = [COMPILER, '-std=c++14', opt, '-fPIC', '-I' + INCLUDE] + EXTRA_ARGS
+        inst = 'outcome_inst%s.o' % opt
+        if run_all([args + ['-c', os.path.join(ROOT, 'src', 'outcome_inst.cpp'), '-o', inst]], workdir) is None:
+            sys.exit(1)
+        for mode, preamble, extra_objects in (('headers', '', []), ('extern templates', '#include "outcome/extern_templates.hpp"\n', [inst])):
+            sources = []
+            for n in range(TUS):
+                sources.append('%s%04d.cpp' % (mode.replace(' ', '_'), n))
+                with open(os.path.join(workdir, sources[-1]), 'wt') as oh:
+                    oh.write(source(n, preamble))
+            objects = [s + opt + '.o' for s in sources]
+            secs = run_all([args + ['-c', s, '-o', o] for s, o in zip(sources, objects)], workdir)
+            if secs is None:
+                sys.exit(1)
+            # Link everything into a shared library to see what survives deduplication of weak symbols
+            linked = 'lib%s%s.so' % (mode.replace(' ', '_'), opt)
+            if run_all([[COMPILER, '-shared', '-o', linked] + objects + extra_objects], workdir) is None:
+                sys.exit(1)
+            inst_bytes = text_bytes(extra_objects, workdir) if extra_objects else 0
+            print('"%s","%s",%d,%f,%f,%d,%d,%d' % (mode, opt, TUS, secs, secs / TUS, text_bytes(objects, workdir), inst_bytes, text_bytes([linked], workdir)))
+finally:
+    shutil.rmtree(workdir)
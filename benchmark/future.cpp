@@ -0,0 +1,110 @@
+/* Benchmark of promise to future round trips by outcome's allocation free future versus std::future
+(C) 2026 agent <agent@local> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../include/outcome/future.hpp"
+#include "timing.h"
+
+#include <future>
+#include <stdio.h>
+#include <system_error>
+
+#define ITERATIONS 1000000
+#define REPETITIONS 5
+
+// Every Nth round trip fails
+static volatile int fail_every = 1 << 30;
+
+// Each round trip makes a fresh shared state, publishes into it and retrieves from it
+QUICKCPPLIB_NOINLINE int std_round_trip(int n)
+{
+  std::promise<int> p;
+  std::future<int> f = p.get_future();
+  if(n % fail_every == 0)
+  {
+#ifdef __cpp_exceptions
+    p.set_exception(std::make_exception_ptr(std::system_error(std::make_error_code(std::errc::invalid_argument))));
+    try
+    {
+      return f.get();
+    }
+    catch(const std::system_error &)
+    {
+      return 0;
+    }
+#endif
+  }
+  p.set_value(n);
+  return f.get();
+}
+
+QUICKCPPLIB_NOINLINE int outcome_round_trip(int n)
+{
+  OUTCOME_V2_NAMESPACE::future_state<int> state;
+  auto p = state.get_promise();
+  auto f = state.get_future();
+  if(n % fail_every == 0)
+  {
+    p.set_error(std::make_error_code(std::errc::invalid_argument));
+  }
+  else
+  {
+    p.set_value(n);
+  }
+  auto o = f.get();
+  return o ? o.value() : 0;
+}
+
+template <int (*F)(int)> double run()
+{
+  double best = 1e300;
+  for(int r = 0; r < REPETITIONS; r++)
+  {
+    long long total = 0;
+    usCount start = GetUsCount();
+    for(int n = 1; n <= ITERATIONS; n++)
+    {
+      total += F(n);
+    }
+    double ns = (GetUsCount() - start) / 1000.0 / ITERATIONS;
+    if(total == 0)
+    {
+      abort();
+    }
+    if(ns < best)
+    {
+      best = ns;
+    }
+  }
+  return best;
+}
+
+int main(void)
+{
+  printf("published,std::future ns per round trip,outcome future ns per round trip\n");
+  fail_every = 1 << 30;
+  printf("values,%f,%f\n", run<std_round_trip>(), run<outcome_round_trip>());
+  fail_every = 2;
+  printf("half errors,%f,%f\n", run<std_round_trip>(), run<outcome_round_trip>());
+  return 0;
+}
@@ -0,0 +1,105 @@
+/* Benchmark of logging failed results to a memory mapped journal versus serialising them to a file stream
+(C) 2026 agent <agent@local> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../include/outcome/iostream_support.hpp"
+#include "../include/outcome/journal.hpp"
+#include "timing.h"
+
+#include <dirent.h>
+#include <fstream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ITERATIONS 1000000
+#define REPETITIONS 5
+
+using result_type = OUTCOME_V2_NAMESPACE::result<int>;
+
+static void remove_dir(const char *dir)
+{
+  DIR *d = opendir(dir);
+  while(const dirent *e = readdir(d))
+  {
+    if(e->d_name[0] != '.')
+    {
+      unlink((std::string(dir) + "/" + e->d_name).c_str());
+    }
+  }
+  closedir(d);
+  rmdir(dir);
+}
+
+template <class F> double run(F &&f)
+{
+  double best = 1e300;
+  for(int r = 0; r < REPETITIONS; r++)
+  {
+    char dir[] = "/tmp/outcome_journal_benchmark_XXXXXX";
+    if(mkdtemp(dir) == nullptr)
+    {
+      abort();
+    }
+    double ns = f(dir);
+    remove_dir(dir);
+    if(ns < best)
+    {
+      best = ns;
+    }
+  }
+  return best;
+}
+
+int main(void)
+{
+  const char payload[] = "request /api/v1/widgets/12345";
+  double stream_ns = run([&](const char *dir) {
+    std::ofstream s(std::string(dir) + "/log.txt");
+    usCount start = GetUsCount();
+    for(int n = 0; n < ITERATIONS; n++)
+    {
+      result_type r(std::error_code(n, std::generic_category()));
+      s << r << ' ' << payload << '\n';
+    }
+    s.flush();
+    return (GetUsCount() - start) / 1000.0 / ITERATIONS;
+  });
+  double journal_ns = run([&](const char *dir) {
+    auto j = OUTCOME_V2_NAMESPACE::journal_writer::create(dir).value();
+    usCount start = GetUsCount();
+    for(int n = 0; n < ITERATIONS; n++)
+    {
+      result_type r(std::error_code(n, std::generic_category()));
+      if(!j.append(r, payload, sizeof(payload) - 1))
+      {
+        abort();
+      }
+    }
+    j.flush();
+    return (GetUsCount() - start) / 1000.0 / ITERATIONS;
+  });
+  printf("std::ofstream << result ns per failure,journal_writer::append() ns per failure\n");
+  printf("%f,%f\n", stream_ns, journal_ns);
+  return 0;
+}
@@ -0,0 +1,106 @@
+#!/usr/bin/python3
+# Benchmark compile times of including Outcome's headers versus importing the Outcome C++ Module
+# (C) 2026 agent agent@local
+# Created: Oct 2026
+#
+# Usage: module_compile.py [translation units] [compiler] [extra compiler args ...]
+# e.g.   module_compile.py 500 g++-13 -I../../quickcpplib
+#
+# Writes a CSV of total wall clock seconds to compile each set of translation units to stdout, along
+# with how many times faster importing the module was than including the headers. Needs GCC 13 or
+# clang 16 or later, as GCC 11 and 12 ICE instantiating any imported result.
+
+import sys, os, subprocess, shutil, tempfile, time
+from concurrent.futures import ThreadPoolExecutor
+
+TUS = int(sys.argv[1]) if len(sys.argv) > 1 else 500
+COMPILER = sys.argv[2] if len(sys.argv) > 2 else 'g++'
+EXTRA_ARGS = sys.argv[3:]
+INCLUDE = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'include')
+IS_CLANG = b'clang' in subprocess.check_output([COMPILER, '--version'])
+VERSION = int(subprocess.check_output([COMPILER, '-dumpversion']).decode().split('.')[0])
+if VERSION < (16 if IS_CLANG else 13):
+    sys.exit('%s %d cannot import the Outcome C++ Module, use GCC 13 or clang 16 or later' % (COMPILER, VERSION))
+
+def source(n, preamble):
+    "A translation unit which does what typical code using Outcome does"
+    return preamble + r'''
+namespace outcome = OUTCOME_V2_NAMESPACE;
+extern outcome::result<int> tu%(p)04d_parse(const char *s);
+outcome::result<int> tu%(n)04d_parse(const char *s)
+{
+  if(s == nullptr)
+  {
+    return std::errc::invalid_argument;
+  }
+  return static_cast<int>(*s) + %(n)d;
+}
+outcome::outcome<long> tu%(n)04d_sum(const char *a, const char *b)
+{
+  OUTCOME_TRY(x, tu%(n)04d_parse(a));
+  OUTCOME_TRY(y, tu%(p)04d_parse(b));
+  return static_cast<long>(x) + y;
+}
+''' % {'n': n, 'p': max(n - 1, 0)}
+
+def compile_all(args, sources, cwd):
+    "Compile each source with args, all processors in parallel, returning wall clock seconds"
+    def compile_one(src):
+        return subprocess.run(args + ['-c', src, '-o', src + '.o'], cwd=cwd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
+    begin = time.perf_counter()
+    with ThreadPoolExecutor(os.cpu_count()) as pool:
+        results = list(pool.map(compile_one, sources))
+    end = time.perf_counter()
+    for r in results:
+        if r.returncode != 0:
+            sys.stderr.write(r.stdout.decode(errors='replace')[:4000])
+            return None
+    return end - begin
+
+workdir = tempfile.mkdtemp(prefix='outcome_module_compile_')
+try:
+    args = [COMPILER, '-std=c++20', '-O2', '-I' + INCLUDE] + EXTRA_ARGS
+    rows = []
+
+    # Headers, as everybody does now
+    sources = []
+    for n in range(TUS):
+        sources.append('header%04d.cpp' % n)
+        with open(os.path.join(workdir, sources[-1]), 'wt') as oh:
+            oh.write(source(n, '#include "outcome.hpp"\n'))
+    rows.append(('headers', compile_all(args, sources, workdir)))
+
+    # The module interface is compiled once, then imported by every translation unit
+    if IS_CLANG:
+        bmi = os.path.join(workdir, 'outcome_v2.pcm')
+        module_args = args + ['-fmodule-file=outcome_v2=' + bmi]
+        interface_args = args + ['-x', 'c++-module', '-fmodule-output=' + bmi]
+    else:
+        with open(os.path.join(workdir, 'outcome_v2.mapper'), 'wt') as oh:
+            oh.write('outcome_v2 outcome_v2.gcm\n')
+        module_args = args + ['-fmodules-ts', '-fmodule-mapper=outcome_v2.mapper']
+        interface_args = module_args + ['-x', 'c++']
+    shutil.copy(os.path.join(INCLUDE, 'outcome.ixx'), os.path.join(workdir, 'outcome.ixx'))
+    rows.append(('module interface', compile_all(interface_args, ['outcome.ixx'], workdir)))
+    sources = []
+    for n in range(TUS):
+        sources.append('module%04d.cpp' % n)
+        with open(os.path.join(workdir, sources[-1]), 'wt') as oh:
+            oh.write(source(n, '#include <system_error>\nimport outcome_v2;\n#include "outcome/try_macros.hpp"\n'))
+    rows.append(('module import', compile_all(module_args, sources, workdir) if rows[-1][1] is not None else None))
+
+    # The module interface is compiled once per build, so it counts towards the cost of importing
+    headers, interface, imports = (r[1] for r in rows)
+    print('"Mode","Translation units","Total seconds","Seconds per translation unit","Times faster than headers"')
+    for mode, secs in rows:
+        tus = 1 if mode == 'module interface' else TUS
+        if secs is None:
+            print('"%s",%d,,,' % (mode, tus))
+        elif mode == 'module import' and headers is not None:
+            print('"%s",%d,%f,%f,%f' % (mode, tus, secs, secs / tus, headers / (interface + secs)))
+        else:
+            print('"%s",%d,%f,%f,' % (mode, tus, secs, secs / tus))
+    if headers is None or imports is None:
+        sys.exit('Some translation units failed to compile, so there is no comparison')
+finally:
+    shutil.rmtree(workdir)
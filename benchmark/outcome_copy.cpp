@@ -0,0 +1,122 @@
+/* Benchmark of the cost of copying excepted outcomes with std::exception_ptr versus inline_exception_ptr
+(C) 2026 agent <agent@local> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../include/outcome/inline_exception_ptr.hpp"
+#include "timing.h"
+
+#include <stdio.h>
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#define ITERATIONS 10000000
+#define REPETITIONS 5
+
+using namespace OUTCOME_V2_NAMESPACE;
+
+using exception_ptr_outcome = outcome<int, std::error_code, std::exception_ptr>;
+using inline_outcome = outcome<int, std::error_code, inline_exception_ptr<>>;
+
+// std::runtime_error's message is itself reference counted by most standard libraries, so also measure
+// an exception type with no reference counted state at all
+struct code_error : std::exception
+{
+  int code;
+  explicit code_error(int c)
+      : code(c)
+  {
+  }
+  const char *what() const noexcept override { return "code_error"; }
+};
+
+template <class T> QUICKCPPLIB_NOINLINE T copy(const T &v)
+{
+  return v;
+}
+
+// Copies and destroys the same excepted outcome from many threads at once, which
+// for std::exception_ptr means contending on the same reference count
+template <class T> double run(const T &v, unsigned threads)
+{
+  double best = 1e300;
+  for(int r = 0; r < REPETITIONS; r++)
+  {
+    std::atomic<unsigned> ready{0};
+    std::vector<std::thread> workers;
+    usCount start = 0;
+    for(unsigned n = 0; n < threads; n++)
+    {
+      workers.emplace_back([&] {
+        ++ready;
+        while(ready < threads)
+        {
+          std::this_thread::yield();
+        }
+        for(int i = 0; i < ITERATIONS / static_cast<int>(threads); i++)
+        {
+          T c(copy(v));
+          if(!c.has_exception())
+          {
+            abort();
+          }
+        }
+      });
+    }
+    while(ready < threads)
+    {
+      std::this_thread::yield();
+    }
+    start = GetUsCount();
+    for(auto &t : workers)
+    {
+      t.join();
+    }
+    double ns = (GetUsCount() - start) / 1000.0 / ITERATIONS;
+    if(ns < best)
+    {
+      best = ns;
+    }
+  }
+  return best;
+}
+
+int main(void)
+{
+  const exception_ptr_outcome a(std::make_exception_ptr(std::runtime_error("failed")));
+  const inline_outcome b(make_inline_exception_ptr<std::runtime_error>("failed"));
+  const inline_outcome c(make_inline_exception_ptr<std::system_error>(std::make_error_code(std::errc::invalid_argument)));
+  const inline_outcome d(make_inline_exception_ptr<code_error>(5));
+  printf("sizeof(outcome<int, std::error_code, std::exception_ptr>) = %u\n", static_cast<unsigned>(sizeof(a)));
+  printf("sizeof(outcome<int, std::error_code, inline_exception_ptr<>>) = %u\n\n", static_cast<unsigned>(sizeof(b)));
+  printf("threads,std::exception_ptr ns/copy,inline std::runtime_error ns/copy,inline std::system_error ns/copy,inline code_error ns/copy\n");
+  const unsigned max_threads = std::max(1U, std::thread::hardware_concurrency());
+  for(unsigned threads = 1; threads <= max_threads; threads *= 2)
+  {
+    printf("%u,%f,%f,%f,%f\n", threads, run(a, threads), run(b, threads), run(c, threads), run(d, threads));
+  }
+  return 0;
+}
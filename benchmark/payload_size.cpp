@@ -0,0 +1,313 @@
+/* Benchmark of returning payloads of 4 bytes to 4Kb in result and outcome versus hand rolled error codes
+(C) 2026 agent <agent@local> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/* Each mechanism propagates through each frame as its users typically would:
+- result and outcome with OUTCOME_TRY, which moves the value into a new result or outcome.
+- std::optional, setting errno on failure, by checking and moving the value into a new optional.
+- An out parameter, plus an int return code, by checking the return code. The caller's storage
+is passed down to the bottom frame, so nothing is moved per frame.
+
+Sizes are swept for a value type R with std::error_code as the error type, and for an error type S
+with int as the value type. In the S sweep there is no std::optional, and the out parameter
+mechanism fills an S out parameter on failure.
+*/
+
+#include "../include/outcome/outcome.hpp"
+#include "../include/outcome/try.hpp"
+#include "timing.h"
+
+#include <cerrno>
+#include <cstring>
+#include <stdio.h>
+#if __cplusplus >= 201703L || _HAS_CXX17
+#include <optional>
+#define HAVE_OPTIONAL 1
+#endif
+
+#define REPETITION_PS 2000000000ULL  // 2ms
+#define REPETITIONS 3
+
+namespace outcome = OUTCOME_V2_NAMESPACE;
+
+static volatile unsigned sink;
+
+// A payload of N bytes, trivially copyable or not
+template <size_t N, bool Trivial> struct payload
+{
+  unsigned char data[N];
+};
+template <size_t N> struct payload<N, false>
+{
+  unsigned char data[N];
+  payload() = default;
+  payload(const payload &o) { memcpy(data, o.data, N); }
+  payload(payload &&o) noexcept { memcpy(data, o.data, N); }
+  payload &operator=(const payload &o)
+  {
+    memcpy(data, o.data, N);
+    return *this;
+  }
+  payload &operator=(payload &&o) noexcept
+  {
+    memcpy(data, o.data, N);
+    return *this;
+  }
+  ~payload() { sink = data[0]; }
+};
+
+template <class T> struct make;
+template <> struct make<int>
+{
+  static int get() { return 1; }
+};
+template <> struct make<std::error_code>
+{
+  static std::error_code get() { return std::make_error_code(std::errc::invalid_argument); }
+};
+template <size_t N, bool Trivial> struct make<payload<N, Trivial>>
+{
+  static payload<N, Trivial> get()
+  {
+    payload<N, Trivial> ret;
+    memset(ret.data, 1, N);
+    return ret;
+  }
+};
+
+static unsigned first_byte(int v)
+{
+  return static_cast<unsigned>(v) & 0xff;
+}
+static unsigned first_byte(const std::error_code &v)
+{
+  return static_cast<unsigned>(v.value()) & 0xff;
+}
+template <size_t N, bool Trivial> static unsigned first_byte(const payload<N, Trivial> &v)
+{
+  return v.data[0];
+}
+
+template <template <class, class> class Type, class R, class S> struct try_mechanism
+{
+  using type = Type<R, S>;
+  static QUICKCPPLIB_NOINLINE type chain(unsigned depth, bool fail)
+  {
+    if(depth == 0)
+    {
+      if(fail)
+      {
+        return make<S>::get();
+      }
+      return make<R>::get();
+    }
+    OUTCOME_TRY(v, chain(depth - 1, fail));
+    return std::move(v);
+  }
+  static QUICKCPPLIB_NOINLINE unsigned observe(const type &r) { return r.has_value() ? first_byte(r.assume_value()) : first_byte(r.assume_error()); }
+  static unsigned call(unsigned depth, bool fail) { return observe(chain(depth, fail)); }
+};
+template <class R, class S> using result_type = outcome::result<R, S>;
+template <class R, class S> using outcome_type = outcome::outcome<R, S>;
+template <class R, class S> struct result_mechanism : try_mechanism<result_type, R, S>
+{
+  static constexpr const char *name = "result";
+};
+template <class R, class S> struct outcome_mechanism : try_mechanism<outcome_type, R, S>
+{
+  static constexpr const char *name = "outcome";
+};
+
+#ifdef HAVE_OPTIONAL
+template <class R, class S> struct optional_mechanism
+{
+  static constexpr const char *name = "optional+errno";
+  using type = std::optional<R>;
+  static QUICKCPPLIB_NOINLINE type chain(unsigned depth, bool fail)
+  {
+    if(depth == 0)
+    {
+      if(fail)
+      {
+        errno = EINVAL;
+        return std::nullopt;
+      }
+      return make<R>::get();
+    }
+    type o(chain(depth - 1, fail));
+    if(!o)
+    {
+      return std::nullopt;
+    }
+    return std::move(*o);
+  }
+  static QUICKCPPLIB_NOINLINE unsigned observe(const type &o) { return o ? first_byte(*o) : static_cast<unsigned>(errno); }
+  static unsigned call(unsigned depth, bool fail) { return observe(chain(depth, fail)); }
+};
+#endif
+
+// S is only filled in if it is not std::error_code, else the return code is the error
+template <class R, class S> struct out_parameter_mechanism
+{
+  static constexpr const char *name = "out parameter";
+  struct type
+  {
+    int ec;
+    R out;
+    S err;
+  };
+  static QUICKCPPLIB_NOINLINE int chain(unsigned depth, bool fail, R &out, S &err)
+  {
+    if(depth == 0)
+    {
+      if(fail)
+      {
+        if(!std::is_same<S, std::error_code>::value)
+        {
+          err = make<S>::get();
+        }
+        return EINVAL;
+      }
+      out = make<R>::get();
+      return 0;
+    }
+    int ec = chain(depth - 1, fail, out, err);
+    if(ec != 0)
+    {
+      return ec;
+    }
+    return 0;
+  }
+  static QUICKCPPLIB_NOINLINE unsigned observe(const type &r) { return (r.ec == 0) ? first_byte(r.out) : std::is_same<S, std::error_code>::value ? static_cast<unsigned>(r.ec) : first_byte(r.err); }
+  static unsigned call(unsigned depth, bool fail)
+  {
+    type r;
+    r.ec = chain(depth, fail, r.out, r.err);
+    return observe(r);
+  }
+};
+
+// Best of the repetitions in nanoseconds per call of f
+template <class F> static double time_ns(F &&f)
+{
+  unsigned long long iterations = 1;
+  for(;;)
+  {
+    usCount start = GetUsCount();
+    for(unsigned long long n = 0; n < iterations; n++)
+    {
+      sink = f();
+    }
+    if(GetUsCount() - start >= REPETITION_PS)
+    {
+      break;
+    }
+    iterations *= 2;
+  }
+  double best = 1e300;
+  for(int r = 0; r < REPETITIONS; r++)
+  {
+    usCount start = GetUsCount();
+    for(unsigned long long n = 0; n < iterations; n++)
+    {
+      sink = f();
+    }
+    double ns = (GetUsCount() - start) / 1000.0 / iterations;
+    if(ns < best)
+    {
+      best = ns;
+    }
+  }
+  return best;
+}
+
+static const unsigned depths[] = {0, 1, 2, 4, 8, 16};
+
+template <class Mechanism> static typename Mechanism::type made(bool fail)
+{
+  return Mechanism::chain(0, fail);
+}
+template <class R, class S> static typename out_parameter_mechanism<R, S>::type made_out_parameter(bool fail)
+{
+  typename out_parameter_mechanism<R, S>::type r;
+  r.ec = out_parameter_mechanism<R, S>::chain(0, fail, r.out, r.err);
+  return r;
+}
+
+template <class Mechanism> static void measure(size_t rbytes, size_t sbytes, bool trivial, const typename Mechanism::type &success, const typename Mechanism::type &failure)
+{
+  printf("%s,%u,%u,%d", Mechanism::name, static_cast<unsigned>(rbytes), static_cast<unsigned>(sbytes), trivial);
+  printf(",%f", time_ns([&] { return Mechanism::observe(success); }));
+  printf(",%f", time_ns([&] { return Mechanism::observe(failure); }));
+  for(bool fail : {false, true})
+  {
+    for(unsigned depth : depths)
+    {
+      printf(",%f", time_ns([=] { return Mechanism::call(depth, fail); }));
+    }
+  }
+  printf("\n");
+  fflush(stdout);
+}
+
+template <size_t N, bool Trivial> static void sweep()
+{
+  using P = payload<N, Trivial>;
+  // Sweep the value type
+  measure<result_mechanism<P, std::error_code>>(N, sizeof(std::error_code), Trivial, made<result_mechanism<P, std::error_code>>(false), made<result_mechanism<P, std::error_code>>(true));
+  measure<outcome_mechanism<P, std::error_code>>(N, sizeof(std::error_code), Trivial, made<outcome_mechanism<P, std::error_code>>(false), made<outcome_mechanism<P, std::error_code>>(true));
+#ifdef HAVE_OPTIONAL
+  measure<optional_mechanism<P, std::error_code>>(N, sizeof(int), Trivial, made<optional_mechanism<P, std::error_code>>(false), made<optional_mechanism<P, std::error_code>>(true));
+#endif
+  measure<out_parameter_mechanism<P, std::error_code>>(N, sizeof(int), Trivial, made_out_parameter<P, std::error_code>(false), made_out_parameter<P, std::error_code>(true));
+  // Sweep the error type
+  measure<result_mechanism<int, P>>(sizeof(int), N, Trivial, made<result_mechanism<int, P>>(false), made<result_mechanism<int, P>>(true));
+  measure<outcome_mechanism<int, P>>(sizeof(int), N, Trivial, made<outcome_mechanism<int, P>>(false), made<outcome_mechanism<int, P>>(true));
+  measure<out_parameter_mechanism<int, P>>(sizeof(int), N, Trivial, made_out_parameter<int, P>(false), made_out_parameter<int, P>(true));
+}
+
+int main(void)
+{
+  printf("mechanism,R bytes,S bytes,trivial,observe success ns,observe failure ns");
+  for(const char *path : {"success", "failure"})
+  {
+    for(unsigned depth : depths)
+    {
+      printf(",%s depth %u ns", path, depth);
+    }
+  }
+  printf("\n");
+  sweep<4, true>();
+  sweep<4, false>();
+  sweep<16, true>();
+  sweep<16, false>();
+  sweep<64, true>();
+  sweep<64, false>();
+  sweep<256, true>();
+  sweep<256, false>();
+  sweep<1024, true>();
+  sweep<1024, false>();
+  sweep<4096, true>();
+  sweep<4096, false>();
+  return 0;
+}
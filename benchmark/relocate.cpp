@@ -0,0 +1,144 @@
+/* Benchmark of growing a 1M element array of result/outcome by relocation versus std::vector
+(C) 2026 agent <agent@local> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../include/outcome/relocate.hpp"
+#include "timing.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+#define ELEMENTS 1000000
+#define REPETITIONS 10
+
+// std::unique_ptr with the default deleter is a single pointer, so we opt it into trivial relocation
+namespace OUTCOME_V2_NAMESPACE
+{
+  namespace trait
+  {
+    template <class T> struct is_trivially_relocatable<std::unique_ptr<T>> : std::true_type
+    {
+    };
+  }
+}
+
+// A minimal growable array which grows by relocate()
+template <class T> class relocating_vector
+{
+  T *_begin{nullptr}, *_end{nullptr}, *_capacity{nullptr};
+
+public:
+  relocating_vector() = default;
+  relocating_vector(const relocating_vector &) = delete;
+  relocating_vector &operator=(const relocating_vector &) = delete;
+  ~relocating_vector()
+  {
+    for(T *i = _begin; i != _end; ++i)
+    {
+      i->~T();
+    }
+    free(_begin);
+  }
+  template <class... Args> void emplace_back(Args &&... args)
+  {
+    if(_end == _capacity)
+    {
+      size_t size = _end - _begin, capacity = size ? size * 2 : 1;
+      T *n = static_cast<T *>(malloc(capacity * sizeof(T)));
+      OUTCOME_V2_NAMESPACE::relocate(_begin, _end, n);
+      free(_begin);
+      _begin = n;
+      _end = n + size;
+      _capacity = n + capacity;
+    }
+    new(_end) T(std::forward<Args>(args)...);
+    ++_end;
+  }
+  size_t size() const { return _end - _begin; }
+};
+
+template <class T> struct make;
+template <class T> struct make<OUTCOME_V2_NAMESPACE::result<T>>
+{
+  template <class F> static OUTCOME_V2_NAMESPACE::result<T> get(int n, F &&f)
+  {
+    if(n & 1)
+    {
+      return std::make_error_code(std::errc::invalid_argument);
+    }
+    return f(n);
+  }
+};
+template <class T> struct make<OUTCOME_V2_NAMESPACE::outcome<T>>
+{
+  template <class F> static OUTCOME_V2_NAMESPACE::outcome<T> get(int n, F &&f)
+  {
+    if(n & 1)
+    {
+      return std::make_error_code(std::errc::invalid_argument);
+    }
+    return f(n);
+  }
+};
+
+template <class Container, class T, class F> double grow(F &&f)
+{
+  double best = 1e300;
+  for(int r = 0; r < REPETITIONS; r++)
+  {
+    Container c;
+    usCount start = GetUsCount();
+    for(int n = 0; n < ELEMENTS; n++)
+    {
+      c.emplace_back(make<T>::get(n, f));
+    }
+    double ms = (GetUsCount() - start) / 1000000000.0;
+    if(ms < best)
+    {
+      best = ms;
+    }
+  }
+  return best;
+}
+
+template <class T, class F> void run(const char *name, F &&f)
+{
+  double vec = grow<std::vector<T>, T>(f);
+  double rel = grow<relocating_vector<T>, T>(f);
+  printf("%s,%d,%f,%f\n", name, OUTCOME_V2_NAMESPACE::trait::is_trivially_relocatable<T>::value, vec, rel);
+}
+
+int main(void)
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  printf("type,trivially relocatable,std::vector ms,relocating_vector ms\n");
+  run<result<int>>("result<int>", [](int n) { return n; });
+  run<result<std::string>>("result<std::string>", [](int n) { return std::string(24, static_cast<char>('a' + (n & 15))); });
+  run<result<std::unique_ptr<int>>>("result<std::unique_ptr<int>>", [](int n) { return std::unique_ptr<int>(new int(n)); });
+  run<outcome<int>>("outcome<int>", [](int n) { return n; });
+  run<outcome<std::unique_ptr<int>>>("outcome<std::unique_ptr<int>>", [](int n) { return std::unique_ptr<int>(new int(n)); });
+  return 0;
+}
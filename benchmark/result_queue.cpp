@@ -0,0 +1,157 @@
+/* Benchmark of queueing results through a split status result queue versus a naive queue of results
+(C) 2026 agent <agent@local> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../include/outcome/result_queue.hpp"
+#include "timing.h"
+
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <stdio.h>
+#include <thread>
+
+#define ITEMS 10000000
+#define BATCH 512
+#define REPETITIONS 5
+
+struct Record
+{
+  uint64_t id;
+  double a, b;
+};
+using record_result = OUTCOME_V2_NAMESPACE::result<Record>;
+
+// One in every this many records is a failure
+static volatile unsigned fail_every = 100;
+
+// The traditional way, a locked queue of whole results
+struct naive_queue
+{
+  std::mutex lock;
+  std::queue<record_result> q;
+
+  bool push(record_result &&r)
+  {
+    std::lock_guard<std::mutex> g(lock);
+    if(q.size() >= 4096)
+    {
+      return false;
+    }
+    q.push(std::move(r));
+    return true;
+  }
+  template <class F> size_t consume(F &&f)
+  {
+    std::lock_guard<std::mutex> g(lock);
+    size_t n = q.size();
+    for(size_t i = 0; i < n; i++)
+    {
+      f(q.front());
+      q.pop();
+    }
+    return n;
+  }
+};
+
+struct split_queue
+{
+  OUTCOME_V2_NAMESPACE::spsc_result_queue<Record, std::error_code, 4096, 256> q;
+
+  bool push(record_result &&r) { return q.push(std::move(r)); }
+  template <class F> size_t consume(F &&f)
+  {
+    size_t n = q.drain_values([&](Record &&v) { f(record_result(v)); });
+    record_result r(std::errc::invalid_argument);
+    if(n == 0 && q.pop(r))
+    {
+      f(r);
+      ++n;
+    }
+    return n;
+  }
+};
+
+template <class Queue> double run(bool threaded)
+{
+  double best = 1e300;
+  for(int rep = 0; rep < REPETITIONS; rep++)
+  {
+    auto q = std::make_unique<Queue>();
+    auto produce = [&](unsigned from, unsigned to) {
+      for(unsigned n = from; n < to; n++)
+      {
+        record_result r = (n % fail_every == 0) ? record_result(std::errc::invalid_argument) : record_result(Record{n, 1.0, 2.0});
+        while(!q->push(std::move(r)))
+        {
+          std::this_thread::yield();
+        }
+      }
+    };
+    uint64_t sum = 0;
+    auto consume = [&](size_t count) {
+      while(count > 0)
+      {
+        size_t n = q->consume([&](const record_result &r) { sum += r ? r.assume_value().id : 1; });
+        if(n == 0)
+        {
+          std::this_thread::yield();
+        }
+        count -= n;
+      }
+    };
+    usCount start = GetUsCount();
+    if(threaded)
+    {
+      std::thread producer([&] { produce(0, ITEMS); });
+      consume(ITEMS);
+      producer.join();
+    }
+    else
+    {
+      for(unsigned n = 0; n < ITEMS; n += BATCH)
+      {
+        produce(n, n + BATCH);
+        consume(BATCH);
+      }
+    }
+    double ns = (GetUsCount() - start) / 1000.0 / ITEMS;
+    if(sum == 0)
+    {
+      abort();
+    }
+    if(ns < best)
+    {
+      best = ns;
+    }
+  }
+  return best;
+}
+
+int main(void)
+{
+  printf("producer,naive queue<result> ns per item,spsc_result_queue ns per item\n");
+  printf("same thread,%f,%f\n", run<naive_queue>(false), run<split_queue>(false));
+  printf("other thread,%f,%f\n", run<naive_queue>(true), run<split_queue>(true));
+  return 0;
+}
@@ -0,0 +1,106 @@
+/* Benchmark of a result slot alternating between a container value and an error with and without retained value storage
+(C) 2026 agent <agent@local> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../include/outcome/result.hpp"
+#include "timing.h"
+
+#include <stdio.h>
+#include <vector>
+
+#define ITERATIONS 10000000
+#define REPETITIONS 5
+#define ITEMS 32
+
+// Identical to std::vector<int> except that result retains its storage
+struct retained_vector : std::vector<int>
+{
+  using std::vector<int>::vector;
+};
+namespace OUTCOME_V2_NAMESPACE
+{
+  namespace trait
+  {
+    template <> struct retain_value_storage<retained_vector> : std::true_type
+    {
+    };
+  }
+}
+
+// Every other request fails to parse
+static volatile unsigned fail_mask = 1;
+
+template <class V, bool Assign> QUICKCPPLIB_NOINLINE void parse(OUTCOME_V2_NAMESPACE::result<V> &r, unsigned n)
+{
+  if((n & fail_mask) != 0)
+  {
+    if(Assign)
+    {
+      r = OUTCOME_V2_NAMESPACE::result<V>(std::errc::invalid_argument);
+    }
+    else
+    {
+      r.emplace_error(std::make_error_code(std::errc::invalid_argument));
+    }
+    return;
+  }
+  V &v = r.emplace_value();
+  for(int i = 0; i < ITEMS; i++)
+  {
+    v.push_back(i);
+  }
+}
+
+template <class V, bool Assign> double run()
+{
+  double best = 1e300;
+  for(int r = 0; r < REPETITIONS; r++)
+  {
+    OUTCOME_V2_NAMESPACE::result<V> slot(std::errc::invalid_argument);
+    size_t total = 0;
+    usCount start = GetUsCount();
+    for(unsigned n = 0; n < ITERATIONS; n++)
+    {
+      parse<V, Assign>(slot, n);
+      total += slot ? slot.assume_value().size() : 0;
+    }
+    double ns = (GetUsCount() - start) / 1000.0 / ITERATIONS;
+    if(total == 0)
+    {
+      abort();
+    }
+    if(ns < best)
+    {
+      best = ns;
+    }
+  }
+  return best;
+}
+
+int main(void)
+{
+  printf("failure by,std::vector<int> ns per parse,retained std::vector<int> ns per parse\n");
+  printf("emplace_error(),%f,%f\n", run<std::vector<int>, false>(), run<retained_vector, false>());
+  printf("assignment,%f,%f\n", run<std::vector<int>, true>(), run<retained_vector, true>());
+  return 0;
+}
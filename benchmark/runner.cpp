@@ -1,37 +1,132 @@
+/* Times calls down a chain of functions, each in its own translation unit, generated by benchmark.py
+(C) 2017-2018 Niall Douglas <http://www.nedproductions.biz/> (2 commits)
+File Created: Mar 2017
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
 #include "timing.h"
-#include "../include/outcome/result.hpp"
-#include <stdio.h>
-#include <exception>
+// Declares function_type, function_table[] and FUNCTIONS for the configuration being built
 #include "function.h"
 
-#define ITERATIONS 100000
-#define CPU_US_PER_CLOCK (1000000000000.0/(3292.0*1000000.0))
+#include <exception>
+#include <stdio.h>
+#include <stdlib.h>
+
+// How long each repetition runs for at minimum, in picoseconds
+#define REPETITION_PS 20000000000ULL  // 20ms
+#define WARMUP_PS 200000000000ULL     // 200ms
 
-extern volatile int counter;
-volatile int counter, forcereturn;
+extern volatile int counter, fail;
+volatile int counter, fail, forcereturn;
 
-int main(void)
+static bool is_ok(int v)
+{
+  return v >= 0;
+}
+template <class T> static bool is_ok(const T &v)
+{
+  return v.has_value();
+}
+
+static void call(int depth, int n)
 {
-  usCount start=GetUsCount();
-  while(GetUsCount()-start<1*1000000000000LL);
-  start=GetUsCount();
-  for(int n=0; n<ITERATIONS; n++)
-  {
 #if !defined(_CPPUNWIND) && !defined(__EXCEPTIONS)
-    forcereturn += !FUNCTION(n);
+  forcereturn += !is_ok(function_table[depth - 1](n));
 #else
-    try
+  try
+  {
+    forcereturn += !is_ok(function_table[depth - 1](n));
+  }
+  catch(const std::exception &)
+  {
+    forcereturn += 1;
+  }
+#endif
+}
+
+// Returns the best of the repetitions in nanoseconds per call
+static double time_calls(int depth, int repetitions)
+{
+  // Find how many calls take at least REPETITION_PS
+  unsigned long long iterations = 1;
+  for(;;)
+  {
+    usCount start = GetUsCount();
+    for(unsigned long long n = 0; n < iterations; n++)
     {
-      forcereturn += !FUNCTION(n);
+      call(depth, (int) n);
     }
-    catch(const std::exception &)
+    if(GetUsCount() - start >= REPETITION_PS)
     {
+      break;
     }
-#endif
+    iterations *= 2;
+  }
+  double best = 1e300;
+  for(int r = 0; r < repetitions; r++)
+  {
+    usCount start = GetUsCount();
+    for(unsigned long long n = 0; n < iterations; n++)
+    {
+      call(depth, (int) n);
+    }
+    double ns = (GetUsCount() - start) / 1000.0 / iterations;
+    if(ns < best)
+    {
+      best = ns;
+    }
+  }
+  return best;
+}
+
+// Usage: runner repetitions depth...
+int main(int argc, char *argv[])
+{
+  if(argc < 3)
+  {
+    fprintf(stderr, "Usage: %s repetitions depth...\n", argv[0]);
+    return 1;
+  }
+  int repetitions = atoi(argv[1]);
+  // Let the CPU clock up before timing anything
+  usCount start = GetUsCount();
+  while(GetUsCount() - start < WARMUP_PS)
+  {
+    call(1, 0);
+  }
+  printf("\"Depth\",\"Success ns per call\",\"Failure ns per call\"\n");
+  for(int arg = 2; arg < argc; arg++)
+  {
+    int depth = atoi(argv[arg]);
+    if(depth < 1 || depth > FUNCTIONS)
+    {
+      fprintf(stderr, "Depth %d is not between 1 and %d\n", depth, FUNCTIONS);
+      return 1;
+    }
+    fail = 0;
+    double success = time_calls(depth, repetitions);
+    fail = 1;
+    double failure = time_calls(depth, repetitions);
+    printf("%d,%f,%f\n", depth, success, failure);
+    fflush(stdout);
   }
-  double time=GetUsCount()-start;
-  time/=ITERATIONS;
-  double ticks=time/CPU_US_PER_CLOCK/*/NESTING*/;
-  printf("%f\n", ticks);
   return 0;
 }
@@ -0,0 +1,101 @@
+/* Benchmark of shuffling and sorting arrays of results which are half errored
+(C) 2026 agent <agent@local> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../include/outcome/result.hpp"
+#include "timing.h"
+
+#include <stdio.h>
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#define ELEMENTS 1000000
+#define REPETITIONS 5
+
+// std::unique_ptr with the default deleter is a single pointer, so we opt it into trivial relocation
+namespace OUTCOME_V2_NAMESPACE
+{
+  namespace trait
+  {
+    template <class T> struct is_trivially_relocatable<std::unique_ptr<T>> : std::true_type
+    {
+    };
+  }
+}
+
+// Errors sort before values, values sort by their key
+inline int key(const std::string &v) { return v[0]; }
+inline int key(const std::unique_ptr<int> &v) { return *v; }
+template <class T> struct result_less
+{
+  bool operator()(const T &a, const T &b) const
+  {
+    if(!a || !b)
+    {
+      return !a && b;
+    }
+    return key(a.assume_value()) < key(b.assume_value());
+  }
+};
+
+template <class T, class F> void run(const char *name, F &&make)
+{
+  std::mt19937 rand(78);
+  double shuffle = 1e300, sort = 1e300;
+  for(int r = 0; r < REPETITIONS; r++)
+  {
+    std::vector<T> v;
+    v.reserve(ELEMENTS);
+    for(int n = 0; n < ELEMENTS; n++)
+    {
+      if(n & 1)
+      {
+        v.emplace_back(std::errc::invalid_argument);
+      }
+      else
+      {
+        v.emplace_back(make(n));
+      }
+    }
+    usCount start = GetUsCount();
+    std::shuffle(v.begin(), v.end(), rand);
+    usCount mid = GetUsCount();
+    std::sort(v.begin(), v.end(), result_less<T>());
+    usCount end = GetUsCount();
+    shuffle = std::min(shuffle, (mid - start) / 1000000000.0);
+    sort = std::min(sort, (end - mid) / 1000000000.0);
+  }
+  printf("%s,%d,%f,%f\n", name, OUTCOME_V2_NAMESPACE::trait::is_trivially_relocatable<T>::value, shuffle, sort);
+}
+
+int main(void)
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  printf("type,trivially relocatable,shuffle ms,sort ms\n");
+  run<result<std::string>>("result<std::string>", [](int n) { return std::string(8, static_cast<char>('a' + (n % 26))); });
+  run<result<std::unique_ptr<int>>>("result<std::unique_ptr<int>>", [](int n) { return std::unique_ptr<int>(new int(n % 26)); });
+  return 0;
+}
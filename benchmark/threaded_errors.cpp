@@ -0,0 +1,234 @@
+/* Benchmark of how error propagation throughput scales with threads, for exceptions versus result and outcome
+(C) 2026 agent <agent@local> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/* Usage: threaded_errors [max threads] [error rate percent...]
+e.g.   threaded_errors 16 0.1 1 10 50
+
+Error rates are clamped to between 0% and 100%.
+
+When many threads throw at once, they can contend inside the unwinder. With older glibc the
+unwinder takes a global lock in dl_iterate_phdr to find each frame's unwind tables. Returning a
+result or outcome never enters the unwinder, whatever the error rate.
+*/
+
+#include "../include/outcome/outcome.hpp"
+#include "../include/outcome/try.hpp"
+#include "timing.h"
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <stdio.h>
+#include <stdlib.h>
+#include <thread>
+#include <vector>
+
+#define DEPTH 10
+#define DURATION_MS 250
+#define REPETITIONS 3
+
+namespace outcome = OUTCOME_V2_NAMESPACE;
+
+// Each frame has something to clean up, as real code does
+struct cleanup
+{
+  unsigned &count;
+  ~cleanup() { ++count; }
+};
+
+QUICKCPPLIB_NOINLINE int throwing(unsigned depth, bool fail, unsigned &cleanups)
+{
+  cleanup c{cleanups};
+  if(depth == 0)
+  {
+    if(fail)
+    {
+      throw std::runtime_error("failed");
+    }
+    return 1;
+  }
+  return throwing(depth - 1, fail, cleanups) + 1;
+}
+
+struct error_code_failure
+{
+  template <class R> static R make() { return std::make_error_code(std::errc::invalid_argument); }
+};
+struct exception_ptr_failure
+{
+  template <class R> static R make() { return std::make_exception_ptr(std::runtime_error("failed")); }
+};
+
+template <class R, class Failure> QUICKCPPLIB_NOINLINE R returning(unsigned depth, bool fail, unsigned &cleanups)
+{
+  cleanup c{cleanups};
+  if(depth == 0)
+  {
+    if(fail)
+    {
+      return Failure::template make<R>();
+    }
+    return 1;
+  }
+  OUTCOME_TRY(v, (returning<R, Failure>(depth - 1, fail, cleanups)));
+  return v + 1;
+}
+
+// Each call returns true if it failed
+static bool call_exceptions(bool fail, unsigned &cleanups)
+{
+  try
+  {
+    return throwing(DEPTH, fail, cleanups) != DEPTH + 1;
+  }
+  catch(const std::exception &)
+  {
+    return true;
+  }
+}
+template <class R, class Failure> static bool call_returning(bool fail, unsigned &cleanups)
+{
+  return !returning<R, Failure>(DEPTH, fail, cleanups);
+}
+
+// Stops the optimiser discarding the work
+static std::atomic<unsigned long long> sink;
+
+// Calls per second across all threads, with fail chosen at random at error_rate
+static double throughput(bool (*call)(bool, unsigned &), unsigned threads, double error_rate)
+{
+  const uint32_t threshold = static_cast<uint32_t>(error_rate * 4294967295.0);
+  std::atomic<unsigned> ready(0);
+  std::atomic<bool> go(false), stop(false);
+  std::vector<unsigned long long> calls(threads);
+  std::vector<std::thread> workers;
+  for(unsigned t = 0; t < threads; t++)
+  {
+    workers.emplace_back([&, t] {
+      uint32_t x = 2463534242U + t * 7919U;  // xorshift32, seeded differently per thread
+      unsigned long long mycalls = 0, myerrors = 0;
+      unsigned cleanups = 0;
+      ++ready;
+      while(!go)
+      {
+        std::this_thread::yield();
+      }
+      while(!stop.load(std::memory_order_relaxed))
+      {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        myerrors += call(x < threshold, cleanups);
+        mycalls++;
+      }
+      calls[t] = mycalls;
+      sink.fetch_add(myerrors + cleanups, std::memory_order_relaxed);
+    });
+  }
+  while(ready != threads)
+  {
+    std::this_thread::yield();
+  }
+  usCount start = GetUsCount();
+  go = true;
+  std::this_thread::sleep_for(std::chrono::milliseconds(DURATION_MS));
+  stop = true;
+  usCount end = GetUsCount();
+  unsigned long long total = 0;
+  for(unsigned t = 0; t < threads; t++)
+  {
+    workers[t].join();
+    total += calls[t];
+  }
+  return total / ((end - start) / 1000000000000.0);
+}
+
+int main(int argc, char *argv[])
+{
+  unsigned max_threads = (argc > 1) ? atoi(argv[1]) : std::thread::hardware_concurrency();
+  std::vector<double> error_rates;
+  for(int n = 2; n < argc; n++)
+  {
+    double error_rate = atof(argv[n]) / 100.0;
+    // Converting a rate above one into the uint32_t threshold would overflow
+    if(!(error_rate >= 0 && error_rate <= 1))
+    {
+      error_rate = (error_rate > 1) ? 1 : 0;
+      fprintf(stderr, "Error rate %s%% clamped to %f%%\n", argv[n], error_rate * 100.0);
+    }
+    error_rates.push_back(error_rate);
+  }
+  if(error_rates.empty())
+  {
+    error_rates = {0.001, 0.01, 0.1, 0.5};
+  }
+  if(max_threads < 1)
+  {
+    max_threads = 1;
+  }
+  std::vector<unsigned> thread_counts;
+  for(unsigned threads = 1; threads < max_threads; threads *= 2)
+  {
+    thread_counts.push_back(threads);
+  }
+  thread_counts.push_back(max_threads);
+
+  struct
+  {
+    const char *name;
+    bool (*call)(bool, unsigned &);
+  } mechanisms[] = {
+  {"exceptions", call_exceptions},                                                              //
+  {"result<int>", call_returning<outcome::result<int>, error_code_failure>},                    //
+  {"outcome<int>", call_returning<outcome::outcome<int>, error_code_failure>},                  //
+  {"outcome<int> exception_ptr", call_returning<outcome::outcome<int>, exception_ptr_failure>}  //
+  };
+  printf("mechanism,error rate percent,threads,calls per second,scaling versus one thread\n");
+  for(auto &mechanism : mechanisms)
+  {
+    for(double error_rate : error_rates)
+    {
+      double one = 0;
+      for(unsigned threads : thread_counts)
+      {
+        double best = 0;
+        for(int r = 0; r < REPETITIONS; r++)
+        {
+          double t = throughput(mechanism.call, threads, error_rate);
+          if(t > best)
+          {
+            best = t;
+          }
+        }
+        if(threads == 1)
+        {
+          one = best;
+        }
+        printf("%s,%f,%u,%f,%f\n", mechanism.name, error_rate * 100.0, threads, best, best / one);
+        fflush(stdout);
+      }
+    }
+  }
+  return 0;
+}
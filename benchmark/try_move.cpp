@@ -0,0 +1,124 @@
+/* Benchmark of exception_ptr reference count operations per hop when propagating with OUTCOME_TRY versus OUTCOME_TRY_MOVE
+(C) 2026 agent <agent@local> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../include/outcome/outcome.hpp"
+#include "../include/outcome/try.hpp"
+#include "timing.h"
+
+#include <stdio.h>
+#include <stdexcept>
+
+#define DEPTH 16
+#define ITERATIONS 100000
+#define REPETITIONS 5
+
+// A std::exception_ptr which counts the atomic reference count operations it causes
+static unsigned long long atomics;
+struct counted_ptr
+{
+  std::exception_ptr ptr;
+  counted_ptr() = default;
+  counted_ptr(std::exception_ptr p)  // NOLINT
+  : ptr(std::move(p))
+  {
+  }
+  counted_ptr(const counted_ptr &o)
+      : ptr(o.ptr)
+  {
+    atomics += (ptr != nullptr);
+  }
+  counted_ptr(counted_ptr &&) = default;
+  counted_ptr &operator=(const counted_ptr &o)
+  {
+    atomics += (ptr != nullptr) + (o.ptr != nullptr);
+    ptr = o.ptr;
+    return *this;
+  }
+  counted_ptr &operator=(counted_ptr &&o) noexcept
+  {
+    atomics += (ptr != nullptr);
+    ptr = std::move(o.ptr);
+    return *this;
+  }
+  ~counted_ptr() { atomics += (ptr != nullptr); }
+  friend bool operator==(const counted_ptr &a, const counted_ptr &b) noexcept { return a.ptr == b.ptr; }
+  friend bool operator!=(const counted_ptr &a, const counted_ptr &b) noexcept { return a.ptr != b.ptr; }
+  friend std::exception_ptr make_exception_ptr(const counted_ptr &v) { return v.ptr; }
+};
+
+// Each hop TRYs on a local lvalue, as code which inspects or logs the outcome first would
+template <class P, bool Move> QUICKCPPLIB_NOINLINE OUTCOME_V2_NAMESPACE::outcome<int, std::error_code, P> hop(const P &e, int depth)
+{
+  if(depth == 0)
+  {
+    return e;
+  }
+  OUTCOME_V2_NAMESPACE::outcome<int, std::error_code, P> o(hop<P, Move>(e, depth - 1));
+  if(Move)
+  {
+    OUTCOME_TRY_MOVE(v, o);
+    return v + 1;
+  }
+  OUTCOME_TRY(v, o);
+  return v + 1;
+}
+
+template <class P, bool Move> double run(const P &e)
+{
+  double best = 1e300;
+  for(int r = 0; r < REPETITIONS; r++)
+  {
+    usCount start = GetUsCount();
+    for(int n = 0; n < ITERATIONS; n++)
+    {
+      if(!hop<P, Move>(e, DEPTH).has_exception())
+      {
+        abort();
+      }
+    }
+    double ns = (GetUsCount() - start) / 1000.0 / ITERATIONS / DEPTH;
+    if(ns < best)
+    {
+      best = ns;
+    }
+  }
+  return best;
+}
+
+int main(void)
+{
+  const std::exception_ptr e(std::make_exception_ptr(std::runtime_error("failed")));
+  const counted_ptr c(e);
+  atomics = 0;
+  (void) hop<counted_ptr, false>(c, DEPTH);
+  double try_atomics = static_cast<double>(atomics) / DEPTH;
+  atomics = 0;
+  (void) hop<counted_ptr, true>(c, DEPTH);
+  double try_move_atomics = static_cast<double>(atomics) / DEPTH;
+
+  printf("macro,atomic ops per hop,ns per hop\n");
+  printf("OUTCOME_TRY,%f,%f\n", try_atomics, run<std::exception_ptr, false>(e));
+  printf("OUTCOME_TRY_MOVE,%f,%f\n", try_move_atomics, run<std::exception_ptr, true>(e));
+  return 0;
+}
@@ -1,10 +1,16 @@
 # DO NOT EDIT, GENERATED BY SCRIPT
 set(outcome_HEADERS
   "include/outcome/result.h"
+  "include/outcome-basic.hpp"
   "include/outcome.hpp"
+  "include/outcome.ixx"
+  "include/outcome/atomic_result.hpp"
+  "include/outcome/backtrace_sampling.hpp"
   "include/outcome/bad_access.hpp"
+  "include/outcome/category_registry.hpp"
   "include/outcome/config.hpp"
   "include/outcome/convert.hpp"
+  "include/outcome/detail/futex.hpp"
   "include/outcome/detail/outcome_exception_observers.hpp"
   "include/outcome/detail/outcome_exception_observers_impl.hpp"
   "include/outcome/detail/outcome_failure_observers.hpp"
@@ -13,7 +19,13 @@ set(outcome_HEADERS
   "include/outcome/detail/result_storage.hpp"
   "include/outcome/detail/result_value_observers.hpp"
   "include/outcome/detail/value_storage.hpp"
+  "include/outcome/error_info_registry.hpp"
+  "include/outcome/extern_templates.hpp"
+  "include/outcome/format.hpp"
+  "include/outcome/future.hpp"
+  "include/outcome/inline_exception_ptr.hpp"
   "include/outcome/iostream_support.hpp"
+  "include/outcome/journal.hpp"
   "include/outcome/outcome.hpp"
   "include/outcome/policy/all_narrow.hpp"
   "include/outcome/policy/detail/common.hpp"
@@ -23,10 +35,14 @@ set(outcome_HEADERS
   "include/outcome/policy/result_exception_ptr_rethrow.hpp"
   "include/outcome/policy/terminate.hpp"
   "include/outcome/policy/throw_bad_result_access.hpp"
+  "include/outcome/relocate.hpp"
   "include/outcome/result.hpp"
+  "include/outcome/result_queue.hpp"
   "include/outcome/revision.hpp"
+  "include/outcome/shared_result.hpp"
   "include/outcome/success_failure.hpp"
   "include/outcome/try.hpp"
+  "include/outcome/try_macros.hpp"
   "include/outcome/utils.hpp"
   "include/outcome/version.hpp"
   "include/outcome/outcome.natvis"
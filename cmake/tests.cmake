@@ -1,15 +1,26 @@
 # DO NOT EDIT, GENERATED BY SCRIPT
 set(outcome_TESTS
+  "test/basic-header-test.cpp"
   "test/expected-pass.cpp"
+  "test/single-header-basic-test.cpp"
   "test/single-header-test.cpp"
+  "test/tests/atomic-result.cpp"
+  "test/tests/backtrace-sampling.cpp"
+  "test/tests/category-registry.cpp"
   "test/tests/comparison.cpp"
   "test/tests/constexpr.cpp"
   "test/tests/containers.cpp"
   "test/tests/core-outcome.cpp"
   "test/tests/core-result.cpp"
   "test/tests/default-construction.cpp"
+  "test/tests/emplace.cpp"
+  "test/tests/error-info-registry.cpp"
+  "test/tests/extern-templates.cpp"
   "test/tests/fileopen.cpp"
+  "test/tests/format.cpp"
+  "test/tests/future.cpp"
   "test/tests/hooks.cpp"
+  "test/tests/inline-exception-ptr.cpp"
   "test/tests/issue0007.cpp"
   "test/tests/issue0009.cpp"
   "test/tests/issue0010.cpp"
@@ -21,9 +32,15 @@ set(outcome_TESTS
   "test/tests/issue0065.cpp"
   "test/tests/issue0071.cpp"
   "test/tests/issue0095.cpp"
+  "test/tests/journal.cpp"
   "test/tests/noexcept-propagation.cpp"
   "test/tests/propagate.cpp"
+  "test/tests/reference.cpp"
+  "test/tests/relocate.cpp"
+  "test/tests/result-queue.cpp"
+  "test/tests/retain-value-storage.cpp"
   "test/tests/serialisation.cpp"
+  "test/tests/shared-result.cpp"
   "test/tests/success-failure.cpp"
   "test/tests/swap.cpp"
   "test/tests/udts.cpp"
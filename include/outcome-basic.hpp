@@ -0,0 +1,2 @@
+#include "outcome/result.hpp"
+#include "outcome/try.hpp"
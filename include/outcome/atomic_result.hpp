@@ -0,0 +1,201 @@
+/* A single assignment result slot for publication from one thread to many
+(C) 2026 agent <agent@local> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_ATOMIC_RESULT_HPP
+#define OUTCOME_ATOMIC_RESULT_HPP
+
+#include "detail/futex.hpp"
+#include "result.hpp"
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdocumentation"  // Standardese markup confuses clang
+#endif
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+namespace detail
+{
+  /* A single assignment slot for a `T`, with an atomic state word moving from empty,
+  to writing, to ready. Shared by `atomic_result`, `future_state` and `shared_result_array`,
+  the last of which lives in memory shared between processes, so must wait `ProcessShared`.
+  */
+  template <class T, bool ProcessShared = false> class atomic_slot
+  {
+    static constexpr uint32_t _empty = 0, _writing = 1, _ready = 2, _state_mask = 3;
+    // Set by consumers which are about to block, so the producer only makes a syscall if someone is waiting
+    static constexpr uint32_t _waiters = 4;
+
+    mutable std::atomic<uint32_t> _state{_empty};
+    union {
+      empty_type _empty_value;
+      T _value;
+    };
+
+  public:
+    atomic_slot() noexcept : _empty_value() {}
+    atomic_slot(const atomic_slot &) = delete;
+    atomic_slot(atomic_slot &&) = delete;
+    atomic_slot &operator=(const atomic_slot &) = delete;
+    atomic_slot &operator=(atomic_slot &&) = delete;
+    ~atomic_slot() { reset(); }
+
+    template <class... Args> bool emplace(Args &&... args)
+    {
+      uint32_t expected = _state.load(std::memory_order_relaxed) & _waiters;
+      while(!_state.compare_exchange_weak(expected, (expected & _waiters) | _writing, std::memory_order_relaxed, std::memory_order_relaxed))
+      {
+        if((expected & _state_mask) != _empty)
+        {
+          return false;
+        }
+      }
+#ifdef __cpp_exceptions
+      try
+      {
+#endif
+        new(&_value) T(std::forward<Args>(args)...);  // NOLINT
+#ifdef __cpp_exceptions
+      }
+      catch(...)
+      {
+        _state.fetch_and(~_writing, std::memory_order_relaxed);
+        throw;
+      }
+#endif
+      if((_state.exchange(_ready, std::memory_order_release) & _waiters) != 0)
+      {
+        futex_wake_all(&_state, ProcessShared);
+      }
+      return true;
+    }
+    bool is_empty() const noexcept { return (_state.load(std::memory_order_relaxed) & _state_mask) == _empty; }
+    bool is_ready() const noexcept { return (_state.load(std::memory_order_acquire) & _state_mask) == _ready; }
+    const T *try_get() const noexcept { return is_ready() ? &_value : nullptr; }
+    const T &wait() const noexcept
+    {
+      for(;;)
+      {
+        uint32_t state = _state.load(std::memory_order_acquire);
+        if((state & _state_mask) == _ready)
+        {
+          return _value;
+        }
+        if((state & _waiters) == 0 && !_state.compare_exchange_weak(state, state | _waiters, std::memory_order_relaxed, std::memory_order_relaxed))
+        {
+          continue;
+        }
+        futex_wait(&_state, state | _waiters, ProcessShared);
+      }
+    }
+    // For single consumer users, who may move the value out once ready
+    T &wait() noexcept { return const_cast<T &>(static_cast<const atomic_slot *>(this)->wait()); }  // NOLINT
+    void reset() noexcept
+    {
+      if((_state.load(std::memory_order_acquire) & _state_mask) == _ready)
+      {
+        _value.~T();
+      }
+      _state.store(_empty, std::memory_order_relaxed);
+    }
+  };
+}  // namespace detail
+
+/*! A slot into which a `result<R, S, NoValuePolicy>` is written exactly once by a producer thread,
+and from which it may be observed by any number of consumer threads without locking.
+
+The slot's state word moves from empty, to writing, to ready. The producer claims the slot by moving
+it from empty to writing, constructs the result in place, then releases it by moving to ready. Consumers
+observe the result with an acquire load of the state, and block on the state word using a futex on Linux,
+`std::atomic<>::wait()` where available, or else yielding. Consumers only ever see a `const` result.
+
+\tparam R The `value_type` of the result.
+\tparam S The `error_type` of the result.
+\tparam NoValuePolicy The no value policy of the result.
+*/
+template <class R, class S = std::error_code, class NoValuePolicy = policy::default_policy<R, S, void>> class atomic_result
+{
+public:
+  //! The type of result published.
+  using result_type = result<R, S, NoValuePolicy>;
+  //! The success type.
+  using value_type = typename result_type::value_type;
+  //! The failure type.
+  using error_type = typename result_type::error_type;
+
+private:
+  detail::atomic_slot<result_type> _slot;
+
+public:
+  /// \output_section Constructors
+  //! Constructs an empty slot.
+  atomic_result() = default;
+  atomic_result(const atomic_result &) = delete;
+  atomic_result(atomic_result &&) = delete;
+  atomic_result &operator=(const atomic_result &) = delete;
+  atomic_result &operator=(atomic_result &&) = delete;
+  //! Destroys any result published. There must be no concurrent use.
+  ~atomic_result() = default;
+
+  /// \output_section Producer
+  /*! Publishes a result in place constructed from `args...`, if no result has been published yet.
+  \returns True if this call published the result, false if another result has already been or is being published.
+  \param args Arguments with which to in place construct a `result_type`.
+
+  \effects If the slot is empty, claims it, constructs `result_type(args...)` in place, releases it to consumers,
+  and wakes any consumers blocked in `wait()`. If the construction throws, the slot is returned to empty.
+  \throws Any exception the construction of `result_type(Args...)` might throw.
+  */
+  template <class... Args> bool emplace(Args &&... args) { return _slot.emplace(std::forward<Args>(args)...); }
+  /*! Publishes a successful result in place constructed from `args...`, if no result has been published yet.
+  \returns True if this call published the result.
+  */
+  template <class... Args> bool set_value(Args &&... args) { return _slot.emplace(in_place_type<value_type>, std::forward<Args>(args)...); }
+  /*! Publishes a failed result in place constructed from `args...`, if no result has been published yet.
+  \returns True if this call published the result.
+  */
+  template <class... Args> bool set_error(Args &&... args) { return _slot.emplace(in_place_type<error_type>, std::forward<Args>(args)...); }
+
+  /// \output_section Consumers
+  //! True if a result has been published. Acquires the result's state if so.
+  bool is_ready() const noexcept { return _slot.is_ready(); }
+  //! Returns a pointer to the result if it has been published, else null. Never blocks.
+  const result_type *try_get() const noexcept { return _slot.try_get(); }
+  /*! Blocks until a result has been published.
+  \returns A reference to the published result, which remains valid until `reset()` or destruction.
+  */
+  const result_type &wait() const noexcept { return _slot.wait(); }
+
+  /// \output_section Reuse
+  //! Destroys any result published and returns the slot to empty. There must be no concurrent use.
+  void reset() noexcept { _slot.reset(); }
+};
+
+OUTCOME_V2_NAMESPACE_END
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+
+#endif
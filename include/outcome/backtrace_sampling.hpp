@@ -0,0 +1,323 @@
+/* Sampled capture of backtraces of errored result construction
+(C) 2026 agent <agent@local> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_BACKTRACE_SAMPLING_HPP
+#define OUTCOME_BACKTRACE_SAMPLING_HPP
+
+#include "error_info_registry.hpp"
+
+#include <algorithm>  // for std::sort
+#include <vector>
+
+#if defined(__GNUC__) && defined(__linux__) && defined(__GLIBC__) && (defined(__x86_64__) || defined(__i386__) || defined(__aarch64__))
+#define OUTCOME_FRAME_POINTER_UNWINDER 1
+#include <pthread.h>
+#elif defined(__has_include)
+#if __has_include(<execinfo.h>)
+#include <execinfo.h>
+#define OUTCOME_EXECINFO_UNWINDER 1
+#endif
+#endif
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdocumentation"  // Standardese markup confuses clang
+#endif
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+//! A backtrace captured at the point of construction of an errored `result` or `outcome`.
+struct error_backtrace
+{
+  //! The maximum number of frames kept
+  static constexpr size_t max_frames = 16;
+  //! The return addresses of each frame, innermost first
+  void *frames[max_frames];
+  //! The number of valid items in `frames`
+  size_t items{0};
+};
+
+namespace detail
+{
+#ifdef OUTCOME_FRAME_POINTER_UNWINDER
+  struct stack_bounds
+  {
+    uintptr_t lo{0}, hi{0};
+  };
+  inline stack_bounds this_thread_stack_bounds() noexcept
+  {
+    static OUTCOME_THREAD_LOCAL uintptr_t lo, hi;
+    if(hi == 0)
+    {
+      pthread_attr_t attr;
+      if(pthread_getattr_np(pthread_self(), &attr) == 0)
+      {
+        void *addr = nullptr;
+        size_t size = 0;
+        if(pthread_attr_getstack(&attr, &addr, &size) == 0)
+        {
+          lo = reinterpret_cast<uintptr_t>(addr);  // NOLINT
+          hi = lo + size;
+        }
+        pthread_attr_destroy(&attr);
+      }
+    }
+    return {lo, hi};
+  }
+  // Walks the frame pointer chain, which is accurate only for code compiled with -fno-omit-frame-pointer.
+  // Every frame is bounds checked against this thread's stack, so a broken chain merely ends the walk early.
+  QUICKCPPLIB_NOINLINE inline size_t capture_backtrace(void **frames, size_t max, size_t skip) noexcept
+  {
+    struct frame
+    {
+      const frame *next;
+      void *ret;
+    };
+    const stack_bounds bounds = this_thread_stack_bounds();
+    const auto *fp = static_cast<const frame *>(__builtin_frame_address(0));
+    size_t n = 0;
+    while(n < max)
+    {
+      const auto addr = reinterpret_cast<uintptr_t>(fp);  // NOLINT
+      if(addr < bounds.lo || addr + sizeof(frame) > bounds.hi || (addr & (alignof(frame) - 1)) != 0 || fp->ret == nullptr)
+      {
+        break;
+      }
+      if(skip > 0)
+      {
+        --skip;
+      }
+      else
+      {
+        frames[n++] = fp->ret;
+      }
+      if(fp->next <= fp)
+      {
+        break;
+      }
+      fp = fp->next;
+    }
+    return n;
+  }
+#elif defined(OUTCOME_EXECINFO_UNWINDER)
+  QUICKCPPLIB_NOINLINE inline size_t capture_backtrace(void **frames, size_t max, size_t skip) noexcept
+  {
+    void *buffer[64];
+    int items = ::backtrace(buffer, 64);
+    size_t n = 0;
+    for(int i = static_cast<int>(skip) + 1; i < items && n < max; i++)
+    {
+      frames[n++] = buffer[i];
+    }
+    return n;
+  }
+#else
+  inline size_t capture_backtrace(void ** /*unused*/, size_t /*unused*/, size_t /*unused*/) noexcept { return 0; }
+#endif
+
+  inline std::atomic<uint32_t> &backtrace_sample_period_storage() noexcept
+  {
+    static std::atomic<uint32_t> v{100};
+    return v;
+  }
+  // One countdown per thread, shared by every `result` and `outcome` type sampled on that thread
+  inline uint32_t &backtrace_sample_countdown() noexcept
+  {
+    static OUTCOME_THREAD_LOCAL uint32_t v;
+    return v;
+  }
+}  // namespace detail
+
+/*! A lock free, fixed capacity histogram of distinct error origins, where an origin is a distinct backtrace.
+*/
+class error_origin_histogram
+{
+public:
+  //! The maximum number of distinct origins counted
+  static constexpr size_t capacity = 1024;
+  //! A counted error origin
+  struct entry
+  {
+    //! The number of times this origin was sampled
+    uint64_t count;
+    //! The backtrace of the origin
+    error_backtrace backtrace;
+  };
+
+private:
+  struct _bucket
+  {
+    std::atomic<uint64_t> key{0};
+    std::atomic<uint64_t> count{0};
+    std::atomic<bool> ready{false};
+    error_backtrace backtrace;
+  };
+  _bucket _buckets[capacity];
+  std::atomic<uint64_t> _overflow{0};
+
+  static uint64_t _hash(const error_backtrace &bt) noexcept
+  {
+    // FNV-1a over the return addresses
+    uint64_t h = 14695981039346656037ULL;
+    for(size_t n = 0; n < bt.items; n++)
+    {
+      h = (h ^ reinterpret_cast<uintptr_t>(bt.frames[n])) * 1099511628211ULL;  // NOLINT
+    }
+    return (h != 0) ? h : 1;
+  }
+
+public:
+  //! Default constructor
+  error_origin_histogram() noexcept {}  // NOLINT
+  error_origin_histogram(const error_origin_histogram &) = delete;
+  error_origin_histogram(error_origin_histogram &&) = delete;
+  error_origin_histogram &operator=(const error_origin_histogram &) = delete;
+  error_origin_histogram &operator=(error_origin_histogram &&) = delete;
+  ~error_origin_histogram() = default;
+
+  //! Counts one occurrence of the origin with the given backtrace.
+  void add(const error_backtrace &bt) noexcept
+  {
+    const uint64_t key = _hash(bt);
+    for(size_t n = 0; n < capacity; n++)
+    {
+      _bucket &b = _buckets[(key + n) & (capacity - 1)];
+      uint64_t existing = b.key.load(std::memory_order_relaxed);
+      if(existing == 0)
+      {
+        if(b.key.compare_exchange_strong(existing, key, std::memory_order_relaxed))
+        {
+          b.backtrace = bt;
+          b.count.fetch_add(1, std::memory_order_relaxed);
+          b.ready.store(true, std::memory_order_release);
+          return;
+        }
+      }
+      if(existing == key)
+      {
+        b.count.fetch_add(1, std::memory_order_relaxed);
+        return;
+      }
+    }
+    _overflow.fetch_add(1, std::memory_order_relaxed);
+  }
+  //! The number of samples which could not be counted because the histogram was full.
+  uint64_t overflow() const noexcept { return _overflow.load(std::memory_order_relaxed); }
+  //! Returns the origins counted so far, most frequent first.
+  std::vector<entry> snapshot() const
+  {
+    std::vector<entry> ret;
+    for(const auto &b : _buckets)
+    {
+      if(b.ready.load(std::memory_order_acquire))
+      {
+        ret.push_back(entry{b.count.load(std::memory_order_relaxed), b.backtrace});
+      }
+    }
+    std::sort(ret.begin(), ret.end(), [](const entry &a, const entry &b) { return a.count > b.count; });
+    return ret;
+  }
+  //! Zeroes the counts of all origins without forgetting them.
+  void reset_counts() noexcept
+  {
+    for(auto &b : _buckets)
+    {
+      b.count.store(0, std::memory_order_relaxed);
+    }
+    _overflow.store(0, std::memory_order_relaxed);
+  }
+};
+
+//! The process wide registry into which sampled backtraces are stored.
+inline error_info_registry<error_backtrace> &sampled_error_backtraces()
+{
+  return global_error_info_registry<error_backtrace>();
+}
+//! The process wide histogram of sampled error origins.
+inline error_origin_histogram &sampled_error_origins()
+{
+  static error_origin_histogram v;
+  return v;
+}
+
+namespace hooks
+{
+  /*! Sets how often errored constructions are sampled by `sample_error_backtrace()`, process wide.
+  \param period One in every *period* errored constructions per thread is sampled. Zero disables sampling.
+  */
+  inline void set_error_backtrace_sample_period(uint32_t period) noexcept { detail::backtrace_sample_period_storage().store(period, std::memory_order_relaxed); }
+  //! Returns how often errored constructions are sampled by `sample_error_backtrace()`. Defaults to 100.
+  inline uint32_t error_backtrace_sample_period() noexcept { return detail::backtrace_sample_period_storage().load(std::memory_order_relaxed); }
+
+  /*! A ready made construction hook implementation which samples the backtrace of errored `result`
+  and `outcome` construction.
+  \returns True if this construction was sampled.
+  \param r The `result` or `outcome` being constructed.
+
+  \effects If `r` has an error or exception, decrements a per thread counter shared by all
+  `result` and `outcome` types. When it reaches zero it is reset to `error_backtrace_sample_period()`,
+  the backtrace of the current thread is captured by walking the frame pointer chain, the backtrace is stored
+  into `sampled_error_backtraces()` with its short handle written into the spare storage of `r`,
+  and the origin is counted in `sampled_error_origins()`.
+
+  Call this from your own `hook_result_construction()`, `hook_outcome_construction()` etc
+  for the types you wish to sample. On Linux the frame pointer chain is walked directly, which
+  is far cheaper than `::backtrace()`, but requires code compiled with `-fno-omit-frame-pointer`
+  for complete backtraces. Elsewhere `::backtrace()` is used if available.
+  */
+  template <class R, class S, class NoValuePolicy> inline bool sample_error_backtrace(detail::result_final<R, S, NoValuePolicy> *r) noexcept
+  {
+    if(!r->has_error() && !r->has_exception())
+    {
+      return false;
+    }
+    const uint32_t period = error_backtrace_sample_period();
+    uint32_t &countdown = detail::backtrace_sample_countdown();
+    if(period == 0)
+    {
+      return false;
+    }
+    if(countdown == 0 || countdown > period)
+    {
+      countdown = period;
+    }
+    if(--countdown != 0)
+    {
+      return false;
+    }
+    error_backtrace bt;
+    bt.items = detail::capture_backtrace(bt.frames, error_backtrace::max_frames, 0);
+    sampled_error_origins().add(bt);
+    sampled_error_backtraces().attach(r, bt);
+    return true;
+  }
+}  // namespace hooks
+
+OUTCOME_V2_NAMESPACE_END
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+
+#endif
@@ -0,0 +1,299 @@
+/* A registry of error categories with identifiers stable across processes and builds
+(C) 2026 agent <agent@local> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_CATEGORY_REGISTRY_HPP
+#define OUTCOME_CATEGORY_REGISTRY_HPP
+
+#include "result.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>  // for strcmp
+#include <future>   // for future_category
+#include <ios>      // for iostream_category
+#include <mutex>
+#include <string>
+
+#ifndef OUTCOME_CATEGORY_REGISTRY_SIZE
+//! The most error categories which may be registered, a power of two.
+#define OUTCOME_CATEGORY_REGISTRY_SIZE 256
+#endif
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdocumentation"  // Standardese markup confuses clang
+#endif
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+namespace detail
+{
+  // 64 bit FNV-1a, chosen as it is trivially reimplemented in any language which needs to read the ids
+  constexpr inline uint64_t category_name_hash(const char *name) noexcept
+  {
+    uint64_t ret = 0xcbf29ce484222325ULL;
+    for(; *name != 0; ++name)
+    {
+      ret = (ret ^ static_cast<unsigned char>(*name)) * 0x100000001b3ULL;
+    }
+    return ret;
+  }
+
+  class category_registry_impl
+  {
+    static constexpr size_t _size = OUTCOME_CATEGORY_REGISTRY_SIZE;
+    static_assert((_size & (_size - 1)) == 0, "OUTCOME_CATEGORY_REGISTRY_SIZE must be a power of two");
+
+    // Open addressed tables which are only ever added to, so lookups need no lock. The category is
+    // published after the id, so a non-null category means the id is valid.
+    struct _entry
+    {
+      std::atomic<uint64_t> id{0};
+      std::atomic<const std::error_category *> category{nullptr};
+    };
+    _entry _by_id[_size];
+    _entry _by_category[_size];
+    std::mutex _lock;
+    size_t _count{0};
+
+    static size_t _hash(const std::error_category *cat) noexcept { return static_cast<size_t>((reinterpret_cast<uintptr_t>(cat) >> 4) * 0x9e3779b97f4a7c15ULL >> 32); }  // NOLINT
+    static void _insert(_entry *table, size_t h, uint64_t id, const std::error_category *cat) noexcept
+    {
+      for(size_t n = 0;; n++)
+      {
+        _entry &e = table[(h + n) & (_size - 1)];
+        if(e.category.load(std::memory_order_relaxed) == nullptr)
+        {
+          e.id.store(id, std::memory_order_relaxed);
+          e.category.store(cat, std::memory_order_release);
+          return;
+        }
+      }
+    }
+
+  public:
+    category_registry_impl()
+    {
+      // Cannot fail as the table is empty
+      (void) add(std::generic_category());
+      (void) add(std::system_category());
+      (void) add(std::iostream_category());
+      (void) add(std::future_category());
+    }
+
+    const std::error_category *find(uint64_t id) const noexcept
+    {
+      for(size_t n = 0; n < _size; n++)
+      {
+        const _entry &e = _by_id[(id + n) & (_size - 1)];
+        const std::error_category *cat = e.category.load(std::memory_order_acquire);
+        if(cat == nullptr)
+        {
+          return nullptr;
+        }
+        if(e.id.load(std::memory_order_relaxed) == id)
+        {
+          return cat;
+        }
+      }
+      return nullptr;
+    }
+    bool find(const std::error_category &c, uint64_t &id) const noexcept
+    {
+      const size_t h = _hash(&c);
+      for(size_t n = 0; n < _size; n++)
+      {
+        const _entry &e = _by_category[(h + n) & (_size - 1)];
+        const std::error_category *cat = e.category.load(std::memory_order_acquire);
+        if(cat == nullptr)
+        {
+          return false;
+        }
+        if(cat == &c)
+        {
+          id = e.id.load(std::memory_order_relaxed);
+          return true;
+        }
+      }
+      return false;
+    }
+    result<uint64_t> add(const std::error_category &c) noexcept
+    {
+      std::lock_guard<std::mutex> g(_lock);
+      uint64_t id;
+      if(find(c, id))
+      {
+        return id;
+      }
+      id = category_name_hash(c.name());
+      const std::error_category *existing = find(id);
+      if(existing != nullptr && strcmp(existing->name(), c.name()) != 0)
+      {
+        // Two categories with different names hash to the same id, so neither could be told apart
+        return std::make_error_code(std::errc::file_exists);
+      }
+      // Keep a table load below one half, so probe sequences stay short and there is always an empty entry
+      if(_count >= _size / 2)
+      {
+        return std::make_error_code(std::errc::no_buffer_space);
+      }
+      ++_count;
+      // A second instance of a category with the same name, as can happen across shared libraries, is the same category
+      if(existing == nullptr)
+      {
+        _insert(_by_id, static_cast<size_t>(id), id, &c);
+      }
+      _insert(_by_category, _hash(&c), id, &c);
+      return id;
+    }
+  };
+  inline category_registry_impl &category_registry() noexcept
+  {
+    static category_registry_impl r;
+    return r;
+  }
+}  // namespace detail
+
+/*! Registers an error category, so that codes in it can be decoded by `decode_error_code()`. Codes in a
+category are encoded by `encode_error_code()` whether it has been registered or not. The categories of the
+standard library are always registered.
+
+The id of a category is a 64 bit FNV-1a hash of its `name()`, so it is the same in every process and build
+which knows the category. A category with the same name as one already registered is treated as the same
+category, as duplicate instances are common across shared library boundaries.
+\returns The stable id of the category, `errc::file_exists` if a category with a different name already has
+the same id, or `errc::no_buffer_space` if `OUTCOME_CATEGORY_REGISTRY_SIZE / 2` categories are registered.
+\effects Lookup by id or by category is lock free and O(1) once registered.
+*/
+inline result<uint64_t> register_category(const std::error_category &c) noexcept
+{
+  return detail::category_registry().add(c);
+}
+//! \returns The category registered with `id`, or null if none is.
+inline const std::error_category *find_category(uint64_t id) noexcept
+{
+  return detail::category_registry().find(id);
+}
+//! \returns The stable id of `c`, registering it if necessary. \sa `register_category()`.
+inline result<uint64_t> category_id(const std::error_category &c) noexcept
+{
+  uint64_t id;
+  if(detail::category_registry().find(c, id))
+  {
+    return id;
+  }
+  return register_category(c);
+}
+
+/*! The binary encoding of a `std::error_code`, which has the same meaning in any process which has
+registered the code's category. `bytes` of wire format are a little endian 64 bit category id followed
+by a little endian 32 bit value.
+*/
+struct encoded_error_code
+{
+  //! The stable id of the category.
+  uint64_t category;
+  //! The value of the code.
+  int32_t value;
+
+  //! The size of the wire format.
+  static constexpr size_t bytes = 12;
+
+  //! Writes the wire format into `buffer`, which must have room for `bytes`.
+  void write(char *buffer) const noexcept
+  {
+    const uint32_t v = static_cast<uint32_t>(value);
+    for(size_t n = 0; n < 8; n++)
+    {
+      buffer[n] = static_cast<char>(category >> (8 * n));
+    }
+    for(size_t n = 0; n < 4; n++)
+    {
+      buffer[8 + n] = static_cast<char>(v >> (8 * n));
+    }
+  }
+  //! Reads the wire format from `buffer`.
+  static encoded_error_code read(const char *buffer) noexcept
+  {
+    uint64_t cat = 0;
+    uint32_t v = 0;
+    for(size_t n = 0; n < 8; n++)
+    {
+      cat |= static_cast<uint64_t>(static_cast<unsigned char>(buffer[n])) << (8 * n);
+    }
+    for(size_t n = 0; n < 4; n++)
+    {
+      v |= static_cast<uint32_t>(static_cast<unsigned char>(buffer[8 + n])) << (8 * n);
+    }
+    return {cat, static_cast<int32_t>(v)};
+  }
+};
+
+/*! Encodes `ec` for transport to another process, or for persistence.
+\returns The encoding, or the failure to register the category of `ec`.
+*/
+inline result<encoded_error_code> encode_error_code(const std::error_code &ec) noexcept
+{
+  // Not OUTCOME_TRY, which warns under -Wparentheses on GCC in every translation unit including this header
+  auto id = category_id(ec.category());
+  if(!id)
+  {
+    return id.error();
+  }
+  return encoded_error_code{id.value(), static_cast<int32_t>(ec.value())};
+}
+namespace detail
+{
+  class unknown_category_impl : public std::error_category
+  {
+  public:
+    const char *name() const noexcept override { return "unknown"; }
+    std::string message(int c) const override { return "unknown error " + std::to_string(c); }
+  };
+}  // namespace detail
+//! The category of decoded codes whose category is not registered in this process.
+inline const std::error_category &unknown_category() noexcept
+{
+  static const detail::unknown_category_impl c;
+  return c;
+}
+
+/*! Decodes an `encoded_error_code`.
+
+\returns The error code, which is in `unknown_category()` with its value intact if its category is not
+registered in this process.
+*/
+inline std::error_code decode_error_code(const encoded_error_code &e) noexcept
+{
+  const std::error_category *cat = find_category(e.category);
+  return {static_cast<int>(e.value), (cat != nullptr) ? *cat : unknown_category()};
+}
+
+OUTCOME_V2_NAMESPACE_END
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+
+#endif
@@ -62,6 +62,16 @@ If you are not redirected automatically, follow this link to <a href='https://ne
 */
 #endif
 
+#ifndef OUTCOME_FORCEINLINE
+// Trivial observers are always inlined so -O0 and -Og debug builds do not pay for a call per observation
+#if defined(_MSC_VER) && !defined(__clang__)
+#define OUTCOME_FORCEINLINE __forceinline
+#elif defined(__GNUC__) || defined(__clang__)
+#define OUTCOME_FORCEINLINE __attribute__((always_inline))
+#else
+#define OUTCOME_FORCEINLINE
+#endif
+#endif
 #ifndef OUTCOME_SYMBOL_VISIBLE
 #define OUTCOME_SYMBOL_VISIBLE QUICKCPPLIB_SYMBOL_VISIBLE
 #endif
@@ -71,6 +81,22 @@ If you are not redirected automatically, follow this link to <a href='https://ne
 #ifndef OUTCOME_THREAD_LOCAL
 #define OUTCOME_THREAD_LOCAL QUICKCPPLIB_THREAD_LOCAL
 #endif
+#ifndef OUTCOME_INLINE_CONSTEXPR
+#ifdef __cpp_inline_variables
+// Namespace scope constants must not have internal linkage if templates exported from a C++ Module use them
+#define OUTCOME_INLINE_CONSTEXPR inline constexpr
+#else
+#define OUTCOME_INLINE_CONSTEXPR static constexpr
+#endif
+#endif
+#ifndef OUTCOME_USE_CXX20_CONCEPTS
+#if defined(__cpp_concepts) && __cpp_concepts >= 201907L
+// C++ 20 Concepts, rather than the Concepts TS, let predicates and storage selection do much less work
+#define OUTCOME_USE_CXX20_CONCEPTS 1
+#else
+#define OUTCOME_USE_CXX20_CONCEPTS 0
+#endif
+#endif
 #ifndef OUTCOME_TEMPLATE
 #define OUTCOME_TEMPLATE(...) QUICKCPPLIB_TEMPLATE(__VA_ARGS__)
 #endif
@@ -0,0 +1,96 @@
+/* Waiting upon and waking an atomic 32 bit word
+(C) 2026 agent <agent@local> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_FUTEX_HPP
+#define OUTCOME_FUTEX_HPP
+
+#include "../config.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <thread>  // for yield
+
+// The Linux futex is preferred as unlike std::atomic<>::wait() it can be process shared
+#if defined(__linux__)
+#define OUTCOME_FUTEX_USE_LINUX_FUTEX 1
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#elif defined(__cpp_lib_atomic_wait)
+#define OUTCOME_FUTEX_USE_ATOMIC_WAIT 1
+#endif
+
+OUTCOME_V2_NAMESPACE_BEGIN
+
+namespace detail
+{
+  static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "std::atomic<uint32_t> is not the size of uint32_t, so cannot be used as a futex");
+
+  /* Blocks the calling thread while `*addr == expected`, and may return spuriously, so callers
+  must recheck their condition in a loop. If `process_shared`, wakeups from other processes
+  mapping the same memory are seen, which costs a little more on Linux.
+  */
+  inline void futex_wait(const std::atomic<uint32_t> *addr, uint32_t expected, bool process_shared = false) noexcept
+  {
+#if defined(OUTCOME_FUTEX_USE_LINUX_FUTEX)
+    // The kernel compares the word against expected atomically with going to sleep
+    ::syscall(SYS_futex, reinterpret_cast<const uint32_t *>(addr), process_shared ? FUTEX_WAIT : FUTEX_WAIT_PRIVATE, expected, nullptr, nullptr, 0);  // NOLINT
+#elif defined(OUTCOME_FUTEX_USE_ATOMIC_WAIT)
+    // std::atomic<>::wait() need not work across processes, so poll
+    if(process_shared)
+    {
+      if(addr->load(std::memory_order_acquire) == expected)
+      {
+        std::this_thread::yield();
+      }
+      return;
+    }
+    addr->wait(expected, std::memory_order_acquire);
+#else
+    (void) process_shared;
+    if(addr->load(std::memory_order_acquire) == expected)
+    {
+      std::this_thread::yield();
+    }
+#endif
+  }
+  //! Wakes all threads blocked in `futex_wait()` upon `addr`.
+  inline void futex_wake_all(std::atomic<uint32_t> *addr, bool process_shared = false) noexcept
+  {
+#if defined(OUTCOME_FUTEX_USE_LINUX_FUTEX)
+    ::syscall(SYS_futex, reinterpret_cast<uint32_t *>(addr), process_shared ? FUTEX_WAKE : FUTEX_WAKE_PRIVATE, INT32_MAX, nullptr, nullptr, 0);  // NOLINT
+#elif defined(OUTCOME_FUTEX_USE_ATOMIC_WAIT)
+    (void) process_shared;
+    addr->notify_all();
+#else
+    // Waiters poll
+    (void) addr;
+    (void) process_shared;
+#endif
+  }
+}  // namespace detail
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
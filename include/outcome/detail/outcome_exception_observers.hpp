@@ -44,13 +44,13 @@ namespace detail
     \returns Reference to the held `exception_type` according to overload.
     \group assume_exception
     */
-    constexpr inline exception_type &assume_exception() & noexcept;
+    OUTCOME_FORCEINLINE constexpr inline exception_type &assume_exception() & noexcept;
     /// \group assume_exception
-    constexpr inline const exception_type &assume_exception() const &noexcept;
+    OUTCOME_FORCEINLINE constexpr inline const exception_type &assume_exception() const &noexcept;
     /// \group assume_exception
-    constexpr inline exception_type &&assume_exception() && noexcept;
+    OUTCOME_FORCEINLINE constexpr inline exception_type &&assume_exception() && noexcept;
     /// \group assume_exception
-    constexpr inline const exception_type &&assume_exception() const &&noexcept;
+    OUTCOME_FORCEINLINE constexpr inline const exception_type &&assume_exception() const &&noexcept;
 
     /// \output_section Wide state observers
     /*! Access exception with runtime checks.
@@ -58,13 +58,13 @@ namespace detail
     \requires The outcome to have an exception state, else whatever `NoValuePolicy` says ought to happen.
     \group exception
     */
-    constexpr inline exception_type &exception() &;
+    OUTCOME_FORCEINLINE constexpr inline exception_type &exception() &;
     /// \group exception
-    constexpr inline const exception_type &exception() const &;
+    OUTCOME_FORCEINLINE constexpr inline const exception_type &exception() const &;
     /// \group exception
-    constexpr inline exception_type &&exception() &&;
+    OUTCOME_FORCEINLINE constexpr inline exception_type &&exception() &&;
     /// \group exception
-    constexpr inline const exception_type &&exception() const &&;
+    OUTCOME_FORCEINLINE constexpr inline const exception_type &&exception() const &&;
   };
 
   template <class Base, class R, class S, class NoValuePolicy> class outcome_exception_observers<Base, R, S, void, NoValuePolicy> : public Base
@@ -74,12 +74,12 @@ namespace detail
     /// \output_section Narrow state observers
     /*! Access exception without runtime checks.
     */
-    constexpr void assume_exception() const noexcept { NoValuePolicy::narrow_exception_check(this); }
+    OUTCOME_FORCEINLINE constexpr void assume_exception() const noexcept { NoValuePolicy::narrow_exception_check(this); }
     /// \output_section Wide state observers
     /*! Access exception with runtime checks.
     \requires The outcome to have an exception state, else whatever `NoValuePolicy` says ought to happen.
     */
-    constexpr void exception() const { NoValuePolicy::wide_exception_check(this); }
+    OUTCOME_FORCEINLINE constexpr void exception() const { NoValuePolicy::wide_exception_check(this); }
   };
 }  // namespace detail
 
@@ -41,14 +41,14 @@ namespace detail
     /// \output_section Synthesising state observers
     /*! Synthesise exception where possible.
     \requires `trait::has_error_code_v<S>` and `trait::has_exception_ptr_v<P>` to be true, else it does not appear.
-    \returns A synthesised exception type: if excepted, `exception()`; if errored, `std::make_exception_ptr(std::system_error(error()))`;
+    \returns A synthesised exception type: if excepted, `policy::exception_ptr(exception())`; if errored, `std::make_exception_ptr(std::system_error(error()))`;
     otherwise a default constructed exception type.
     */
     exception_type failure() const noexcept
     {
       if((this->_state._status & detail::status_have_exception) != 0)
       {
-        return this->exception();
+        return policy::exception_ptr(this->exception());
       }
       if((this->_state._status & detail::status_have_error) != 0)
       {
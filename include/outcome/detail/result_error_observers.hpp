@@ -44,25 +44,25 @@ namespace detail
     \returns Reference to the held `error_type` according to overload.
     \group assume_error
     */
-    constexpr error_type &assume_error() & noexcept
+    OUTCOME_FORCEINLINE constexpr error_type &assume_error() & noexcept
     {
       NoValuePolicy::narrow_error_check(static_cast<result_error_observers &>(*this));
       return this->_error;
     }
     /// \group assume_error
-    constexpr const error_type &assume_error() const &noexcept
+    OUTCOME_FORCEINLINE constexpr const error_type &assume_error() const &noexcept
     {
       NoValuePolicy::narrow_error_check(static_cast<const result_error_observers &>(*this));
       return this->_error;
     }
     /// \group assume_error
-    constexpr error_type &&assume_error() && noexcept
+    OUTCOME_FORCEINLINE constexpr error_type &&assume_error() && noexcept
     {
       NoValuePolicy::narrow_error_check(static_cast<result_error_observers &&>(*this));
       return std::move(this->_error);
     }
     /// \group assume_error
-    constexpr const error_type &&assume_error() const &&noexcept
+    OUTCOME_FORCEINLINE constexpr const error_type &&assume_error() const &&noexcept
     {
       NoValuePolicy::narrow_error_check(static_cast<const result_error_observers &&>(*this));
       return std::move(this->_error);
@@ -74,25 +74,25 @@ namespace detail
     \requires The result to have a failed state, else whatever `NoValuePolicy` says ought to happen.
     \group error
     */
-    constexpr error_type &error() &
+    OUTCOME_FORCEINLINE constexpr error_type &error() &
     {
       NoValuePolicy::wide_error_check(static_cast<result_error_observers &>(*this));
       return this->_error;
     }
     /// \group error
-    constexpr const error_type &error() const &
+    OUTCOME_FORCEINLINE constexpr const error_type &error() const &
     {
       NoValuePolicy::wide_error_check(static_cast<const result_error_observers &>(*this));
       return this->_error;
     }
     /// \group error
-    constexpr error_type &&error() &&
+    OUTCOME_FORCEINLINE constexpr error_type &&error() &&
     {
       NoValuePolicy::wide_error_check(static_cast<result_error_observers &&>(*this));
       return std::move(this->_error);
     }
     /// \group error
-    constexpr const error_type &&error() const &&
+    OUTCOME_FORCEINLINE constexpr const error_type &&error() const &&
     {
       NoValuePolicy::wide_error_check(static_cast<const result_error_observers &&>(*this));
       return std::move(this->_error);
@@ -105,12 +105,12 @@ namespace detail
     /// \output_section Narrow state observers
     /*! Access error without runtime checks.
     */
-    constexpr void assume_error() const noexcept { NoValuePolicy::narrow_error_check(*this); }
+    OUTCOME_FORCEINLINE constexpr void assume_error() const noexcept { NoValuePolicy::narrow_error_check(*this); }
     /// \output_section Wide state observers
     /*! Access error with runtime checks.
     \requires The result to have a failed state, else whatever `NoValuePolicy` says ought to happen.
     */
-    constexpr void error() const { NoValuePolicy::wide_error_check(*this); }
+    OUTCOME_FORCEINLINE constexpr void error() const { NoValuePolicy::wide_error_check(*this); }
   };
 }  // namespace detail
 OUTCOME_V2_NAMESPACE_END
@@ -52,23 +52,23 @@ namespace detail
     /*! Checks if has value.
     \returns True if has value.
     */
-    constexpr explicit operator bool() const noexcept { return (this->_state._status & detail::status_have_value) != 0; }
+    OUTCOME_FORCEINLINE constexpr explicit operator bool() const noexcept { return (this->_state._status & detail::status_have_value) != 0; }
     /*! Checks if has value.
     \returns True if has value.
     */
-    constexpr bool has_value() const noexcept { return (this->_state._status & detail::status_have_value) != 0; }
+    OUTCOME_FORCEINLINE constexpr bool has_value() const noexcept { return (this->_state._status & detail::status_have_value) != 0; }
     /*! Checks if has error.
     \returns True if has error.
     */
-    constexpr bool has_error() const noexcept { return (this->_state._status & detail::status_have_error) != 0; }
+    OUTCOME_FORCEINLINE constexpr bool has_error() const noexcept { return (this->_state._status & detail::status_have_error) != 0; }
     /*! Checks if has exception.
     \returns True if has exception.
     */
-    constexpr bool has_exception() const noexcept { return (this->_state._status & detail::status_have_exception) != 0; }
+    OUTCOME_FORCEINLINE constexpr bool has_exception() const noexcept { return (this->_state._status & detail::status_have_exception) != 0; }
     /*! Checks if has error or exception.
     \returns True if has error or exception.
     */
-    constexpr bool has_failure() const noexcept { return (this->_state._status & detail::status_have_error) != 0 && (this->_state._status & detail::status_have_exception) != 0; }
+    OUTCOME_FORCEINLINE constexpr bool has_failure() const noexcept { return (this->_state._status & detail::status_have_error) != 0 && (this->_state._status & detail::status_have_exception) != 0; }
 
     /// \output_section Comparison operators
     /*! True if equal to the other result.
@@ -103,7 +103,7 @@ namespace detail
     {
       if(this->_state._status & detail::status_have_value)
       {
-        return detail::safe_compare_equal(this->_state._value, o._value);  // NOLINT
+        return detail::safe_compare_equal(this->_state._value, o.value());  // NOLINT
       }
       return false;
     }
@@ -160,7 +160,7 @@ namespace detail
     {
       if(this->_state._status & detail::status_have_value)
       {
-        return detail::safe_compare_notequal(this->_state._value, o._value);  // NOLINT
+        return detail::safe_compare_notequal(this->_state._value, o.value());  // NOLINT
       }
       return true;
     }
@@ -53,7 +53,7 @@ namespace detail
   {
     static constexpr bool value = false;
   };
-  template <class T, class U> static constexpr bool is_explicitly_constructible = _is_explicitly_constructible<T, U>::value;
+  template <class T, class U> constexpr bool is_explicitly_constructible = _is_explicitly_constructible<T, U>::value;
 
   template <class T, class U> struct _is_implicitly_constructible
   {
@@ -71,7 +71,7 @@ namespace detail
   {
     static constexpr bool value = false;
   };
-  template <class T, class U> static constexpr bool is_implicitly_constructible = _is_implicitly_constructible<T, U>::value;
+  template <class T, class U> constexpr bool is_implicitly_constructible = _is_implicitly_constructible<T, U>::value;
 
 // True if type is nothrow swappable
 #if !defined(STANDARDESE_IS_IN_THE_HOUSE) && (_HAS_CXX17 || __cplusplus >= 201700)
@@ -140,6 +140,18 @@ namespace detail
   }
   template <class State> constexpr inline void _set_error_is_errno(State &state, const std::errc & /*unused*/) { state._status |= status_error_is_errno; }
 
+  // Replaces a member which is always constructed, in place if that cannot fail, else by assignment from a temporary so the member is never left destroyed
+  template <class T, class... Args> inline void _emplace_member(std::true_type /*unused*/, T &v, Args &&... args) noexcept
+  {
+    v.~T();
+    new(&v) T(std::forward<Args>(args)...);  // NOLINT
+  }
+  template <class T, class... Args> inline void _emplace_member(std::false_type /*unused*/, T &v, Args &&... args) { v = T(std::forward<Args>(args)...); }
+  template <class T, class... Args> inline void emplace_member(T &v, Args &&... args) noexcept((std::is_nothrow_constructible<T, Args...>::value && std::is_nothrow_destructible<T>::value) || (std::is_nothrow_constructible<T, Args...>::value && std::is_nothrow_move_assignable<T>::value))
+  {
+    _emplace_member(std::integral_constant<bool, std::is_nothrow_constructible<T, Args...>::value && std::is_nothrow_destructible<T>::value>(), v, std::forward<Args>(args)...);
+  }
+
   template <class R, class S, class NoValuePolicy> class result_final;
 }  // namespace detail
 //! Namespace containing hooks used for intercepting and manipulating result/outcome
@@ -161,7 +173,7 @@ namespace detail
 {
   //! Predicate for permitting type to be used in outcome
   template <class R>                                                   //
-  static constexpr bool type_can_be_used_in_result =                   //
+  constexpr bool type_can_be_used_in_result =                          //
   (!std::is_reference<R>::value                                        //
    && !detail::is_in_place_type_t<std::decay_t<R>>::value              //
    && !detail::is_success_type<R>::value                               //
@@ -171,12 +183,21 @@ namespace detail
                                   && std::is_destructible<R>::value))  //
    );
 
+  //! Predicate for permitting type to be used as the value type in outcome, which may also be an lvalue reference to object
+  template <class R>                                                       //
+  constexpr bool type_can_be_used_as_value_in_result =                     //
+  (type_can_be_used_in_result<R>                                           //
+   || (std::is_lvalue_reference<R>::value                                  //
+       && std::is_object<std::remove_reference_t<R>>::value                //
+       && type_can_be_used_in_result<std::remove_reference_t<R>>)          //
+   );
+
   //! The base implementation type of `result<R, EC, NoValuePolicy>`.
-  template <class R, class EC, class NoValuePolicy>                                                                                                          //
-  OUTCOME_REQUIRES(type_can_be_used_in_result<R> &&type_can_be_used_in_result<EC> && (std::is_void<EC>::value || std::is_default_constructible<EC>::value))  //
+  template <class R, class EC, class NoValuePolicy>
   class result_storage
   {
-    static_assert(type_can_be_used_in_result<R>, "The type R cannot be used in a result");
+    // Not constraints, as naming a constrained specialisation checks them, and journal_writer names a result of itself while incomplete
+    static_assert(type_can_be_used_as_value_in_result<R>, "The type R cannot be used in a result");
     static_assert(type_can_be_used_in_result<EC>, "The type S cannot be used in a result");
     static_assert(std::is_void<EC>::value || std::is_default_constructible<EC>::value, "The type S must be void or default constructible");
 
@@ -198,17 +219,20 @@ namespace detail
     using _value_type = std::conditional_t<std::is_same<R, EC>::value, disable_in_place_value_type, R>;
     using _error_type = std::conditional_t<std::is_same<R, EC>::value, disable_in_place_error_type, EC>;
 
+    // Lvalue references are stored as a pointer
+    using _value_storage_type = detail::value_storage_type<_value_type>;
+
 #ifdef STANDARDESE_IS_IN_THE_HOUSE
-    detail::value_storage_trivial<_value_type> _state;
+    detail::value_storage_trivial<_value_storage_type> _state;
 #else
-    detail::value_storage_select_impl<_value_type> _state;
+    detail::value_storage_select_impl<_value_storage_type> _state;
 #endif
     detail::devoid<_error_type> _error;
 
   public:
     // Used by iostream support to access state
-    detail::value_storage_select_impl<_value_type> &__state() { return _state; }
-    const detail::value_storage_select_impl<_value_type> &__state() const { return _state; }
+    OUTCOME_FORCEINLINE detail::value_storage_select_impl<_value_storage_type> &__state() { return _state; }
+    OUTCOME_FORCEINLINE const detail::value_storage_select_impl<_value_storage_type> &__state() const { return _state; }
 
   protected:
     result_storage() = default;
@@ -219,14 +243,14 @@ namespace detail
     ~result_storage() = default;
 
     template <class... Args>
-    constexpr explicit result_storage(in_place_type_t<_value_type> _, Args &&... args) noexcept(std::is_nothrow_constructible<_value_type, Args...>::value)
-        : _state{_, std::forward<Args>(args)...}
+    constexpr explicit result_storage(in_place_type_t<_value_type> /*unused*/, Args &&... args) noexcept(std::is_nothrow_constructible<_value_storage_type, Args...>::value)
+        : _state{in_place_type<_value_storage_type>, std::forward<Args>(args)...}
         , _error()
     {
     }
     template <class U, class... Args>
-    constexpr result_storage(in_place_type_t<_value_type> _, std::initializer_list<U> il, Args &&... args) noexcept(std::is_nothrow_constructible<_value_type, std::initializer_list<U>, Args...>::value)
-        : _state{_, il, std::forward<Args>(args)...}
+    constexpr result_storage(in_place_type_t<_value_type> /*unused*/, std::initializer_list<U> il, Args &&... args) noexcept(std::is_nothrow_constructible<_value_storage_type, std::initializer_list<U>, Args...>::value)
+        : _state{in_place_type<_value_storage_type>, il, std::forward<Args>(args)...}
         , _error()
     {
     }
@@ -271,8 +295,31 @@ namespace detail
         , _error(_error_type{})
     {
     }
+    struct failure_forwarding_tag
+    {
+    };
+    // Only the failure state is taken from the source, which must not be valued
+    template <class T, class U, class V>
+    constexpr result_storage(failure_forwarding_tag /*unused*/, const result_storage<T, U, V> &o) noexcept(std::is_nothrow_constructible<_error_type, const U &>::value)
+        : _state{o._state._status & (detail::status_have_error | detail::status_have_exception | detail::status_error_is_errno)}
+        , _error(o._error)
+    {
+    }
+    template <class T, class U, class V>
+    constexpr result_storage(failure_forwarding_tag /*unused*/, result_storage<T, U, V> &&o) noexcept(std::is_nothrow_constructible<_error_type, U &&>::value)
+        : _state{o._state._status & (detail::status_have_error | detail::status_have_exception | detail::status_error_is_errno)}
+        , _error(std::move(o._error))
+    {
+    }
   };
 }  // namespace detail
+
+namespace trait
+{
+  template <class R, class EC, class NoValuePolicy> struct is_trivially_relocatable<OUTCOME_V2_NAMESPACE::detail::result_storage<R, EC, NoValuePolicy>> : std::integral_constant<bool, is_trivially_relocatable<OUTCOME_V2_NAMESPACE::detail::value_storage_select_impl<OUTCOME_V2_NAMESPACE::detail::value_storage_type<R>>>::value && is_trivially_relocatable<EC>::value>
+  {
+  };
+}  // namespace trait
 OUTCOME_V2_NAMESPACE_END
 
 #endif
@@ -44,25 +44,25 @@ namespace detail
     \returns Reference to the held `value_type` according to overload.
     \group assume_value
     */
-    constexpr value_type &assume_value() & noexcept
+    OUTCOME_FORCEINLINE constexpr value_type &assume_value() & noexcept
     {
       NoValuePolicy::narrow_value_check(static_cast<result_value_observers &>(*this));
       return this->_state._value;  // NOLINT
     }
     /// \group assume_value
-    constexpr const value_type &assume_value() const &noexcept
+    OUTCOME_FORCEINLINE constexpr const value_type &assume_value() const &noexcept
     {
       NoValuePolicy::narrow_value_check(static_cast<const result_value_observers &>(*this));
       return this->_state._value;  // NOLINT
     }
     /// \group assume_value
-    constexpr value_type &&assume_value() && noexcept
+    OUTCOME_FORCEINLINE constexpr value_type &&assume_value() && noexcept
     {
       NoValuePolicy::narrow_value_check(static_cast<result_value_observers &&>(*this));
       return std::move(this->_state._value);  // NOLINT
     }
     /// \group assume_value
-    constexpr const value_type &&assume_value() const &&noexcept
+    OUTCOME_FORCEINLINE constexpr const value_type &&assume_value() const &&noexcept
     {
       NoValuePolicy::narrow_value_check(static_cast<const result_value_observers &&>(*this));
       return std::move(this->_state._value);  // NOLINT
@@ -74,25 +74,25 @@ namespace detail
     \requires The result to have a successful state, else whatever `NoValuePolicy` says ought to happen.
     \group value
     */
-    constexpr value_type &value() &
+    OUTCOME_FORCEINLINE constexpr value_type &value() &
     {
       NoValuePolicy::wide_value_check(static_cast<result_value_observers &>(*this));
       return this->_state._value;  // NOLINT
     }
     /// \group value
-    constexpr const value_type &value() const &
+    OUTCOME_FORCEINLINE constexpr const value_type &value() const &
     {
       NoValuePolicy::wide_value_check(static_cast<const result_value_observers &>(*this));
       return this->_state._value;  // NOLINT
     }
     /// \group value
-    constexpr value_type &&value() &&
+    OUTCOME_FORCEINLINE constexpr value_type &&value() &&
     {
       NoValuePolicy::wide_value_check(static_cast<result_value_observers &&>(*this));
       return std::move(this->_state._value);  // NOLINT
     }
     /// \group value
-    constexpr const value_type &&value() const &&
+    OUTCOME_FORCEINLINE constexpr const value_type &&value() const &&
     {
       NoValuePolicy::wide_value_check(static_cast<const result_value_observers &&>(*this));
       return std::move(this->_state._value);  // NOLINT
@@ -106,12 +106,12 @@ namespace detail
     /// \output_section Narrow state observers
     /*! Access value without runtime checks.
     */
-    constexpr void assume_value() const noexcept { NoValuePolicy::narrow_value_check(*this); }
+    OUTCOME_FORCEINLINE constexpr void assume_value() const noexcept { NoValuePolicy::narrow_value_check(*this); }
     /// \output_section Wide state observers
     /*! Access value with runtime checks.
     \requires The result to have a successful state, else whatever `NoValuePolicy` says ought to happen.
     */
-    constexpr void value() const { NoValuePolicy::wide_value_check(*this); }
+    OUTCOME_FORCEINLINE constexpr void value() const { NoValuePolicy::wide_value_check(*this); }
   };
 }  // namespace detail
 
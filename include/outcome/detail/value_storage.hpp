@@ -28,11 +28,17 @@ http://www.boost.org/LICENSE_1_0.txt)
 #include "../config.hpp"
 
 #include <cstdint>  // for uint32_t etc
+#include <cstring>  // for memcpy
 #include <initializer_list>
 #include <iosfwd>  // for serialisation
 #include <type_traits>
 #include <utility>  // for in_place_type_t
 
+// <memory> costs a third of the parse time of result.hpp, and is only wanted for std::addressof
+#if !defined(__GNUC__) && !defined(__clang__) && !(defined(_MSC_VER) && _MSC_VER >= 1910)
+#include <memory>  // for addressof
+#endif
+
 OUTCOME_V2_NAMESPACE_BEGIN
 
 #if __cplusplus >= 201700 || _HAS_CXX17
@@ -50,6 +56,15 @@ template <class T> constexpr in_place_type_t<T> in_place_type{};
 
 namespace detail
 {
+  template <class T> constexpr inline T *addressof(T &v) noexcept
+  {
+#if defined(__GNUC__) || defined(__clang__) || (defined(_MSC_VER) && _MSC_VER >= 1910)
+    return __builtin_addressof(v);
+#else
+    return std::addressof(v);
+#endif
+  }
+
   // Test if type is an in_place_type_t
   template <class T> struct is_in_place_type_t : std::false_type
   {
@@ -58,16 +73,56 @@ namespace detail
   {
   };
 
+  // Stores an lvalue reference as a pointer, which is trivial and rebindable unlike a reference. Null is
+  // never observed as the status bits say whether a value is present, same as for any other value type.
+  template <class T> class reference_storage
+  {
+    template <class U> friend class reference_storage;
+    T *_ptr{nullptr};
+
+  public:
+    using value_type = T &;
+    constexpr reference_storage() noexcept = default;
+    constexpr reference_storage(T &v) noexcept  // NOLINT
+    : _ptr(detail::addressof(v))
+    {
+    }
+    // Would dangle
+    reference_storage(T &&) = delete;  // NOLINT
+    template <class U, typename = std::enable_if_t<!std::is_same<U, T>::value && std::is_convertible<U *, T *>::value>>
+    constexpr reference_storage(const reference_storage<U> &o) noexcept  // NOLINT
+    : _ptr(o._ptr)
+    {
+    }
+    constexpr T &get() const noexcept { return *_ptr; }
+    constexpr operator T &() const noexcept { return *_ptr; }  // NOLINT
+  };
+  template <class T> struct is_reference_storage : std::false_type
+  {
+  };
+  template <class T> struct is_reference_storage<reference_storage<T>> : std::true_type
+  {
+  };
+  // Comparisons are of the referenced objects, as they would be for a reference
+  template <class T, class U> constexpr inline auto operator==(const reference_storage<T> &a, const reference_storage<U> &b) -> decltype(a.get() == b.get()) { return a.get() == b.get(); }
+  template <class T, class U> constexpr inline auto operator!=(const reference_storage<T> &a, const reference_storage<U> &b) -> decltype(a.get() != b.get()) { return a.get() != b.get(); }
+  template <class T, class U, typename = std::enable_if_t<!is_reference_storage<U>::value>> constexpr inline auto operator==(const reference_storage<T> &a, const U &b) -> decltype(a.get() == b) { return a.get() == b; }
+  template <class T, class U, typename = std::enable_if_t<!is_reference_storage<U>::value>> constexpr inline auto operator!=(const reference_storage<T> &a, const U &b) -> decltype(a.get() != b) { return a.get() != b; }
+  template <class T, class U, typename = std::enable_if_t<!is_reference_storage<U>::value>> constexpr inline auto operator==(const U &a, const reference_storage<T> &b) -> decltype(a == b.get()) { return a == b.get(); }
+  template <class T, class U, typename = std::enable_if_t<!is_reference_storage<U>::value>> constexpr inline auto operator!=(const U &a, const reference_storage<T> &b) -> decltype(a != b.get()) { return a != b.get(); }
+  // The type actually stored for a value type of R
+  template <class R> using value_storage_type = std::conditional_t<std::is_lvalue_reference<R>::value, reference_storage<std::remove_reference_t<R>>, R>;
+
   using status_bitfield_type = uint32_t;
-  static constexpr status_bitfield_type status_have_value = (1U << 0U);
-  static constexpr status_bitfield_type status_have_error = (1U << 1U);
-  static constexpr status_bitfield_type status_have_exception = (1U << 2U);
-  static constexpr status_bitfield_type status_error_is_errno = (1U << 4U);  // can errno be set from this error?
+  OUTCOME_INLINE_CONSTEXPR status_bitfield_type status_have_value = (1U << 0U);
+  OUTCOME_INLINE_CONSTEXPR status_bitfield_type status_have_error = (1U << 1U);
+  OUTCOME_INLINE_CONSTEXPR status_bitfield_type status_have_exception = (1U << 2U);
+  OUTCOME_INLINE_CONSTEXPR status_bitfield_type status_error_is_errno = (1U << 4U);  // can errno be set from this error?
   // bit 7 unused
   // bits 8-15 unused
   // bits 16-31 used for user supplied 16 bit value
-  static constexpr status_bitfield_type status_2byte_shift = 16;
-  static constexpr status_bitfield_type status_2byte_mask = (0xffffU << status_2byte_shift);
+  OUTCOME_INLINE_CONSTEXPR status_bitfield_type status_2byte_shift = 16;
+  OUTCOME_INLINE_CONSTEXPR status_bitfield_type status_2byte_mask = (0xffffU << status_2byte_shift);
 
   // Used if T is trivial
   template <class T> struct value_storage_trivial
@@ -126,6 +181,14 @@ namespace detail
     {
       _status = o._status;
     }
+    // Replaces any value with one constructed in place. Args must not refer to the value being replaced.
+    template <class... Args> void emplace(Args &&... args) noexcept(std::is_nothrow_constructible<devoid<T>, Args...>::value)
+    {
+      _status &= ~status_have_value;
+      new(&_value) devoid<T>(std::forward<Args>(args)...);  // NOLINT
+      _status |= status_have_value;
+    }
+    void reset() noexcept { _status &= ~status_have_value; }
     constexpr void swap(value_storage_trivial &o)
     {
       // storage is trivial, so just use assignment
@@ -133,6 +196,7 @@ namespace detail
       swap(*this, o);
     }
   };
+  template <class T> struct value_storage_retaining;
   // Used if T is non-trivial
   template <class T> struct value_storage_nontrivial
   {
@@ -222,6 +286,20 @@ namespace detail
     {
       _status = o._status;
     }
+    OUTCOME_TEMPLATE(class U)
+    OUTCOME_TREQUIRES(OUTCOME_TPRED(enable_converting_constructor<U>))
+    constexpr explicit value_storage_nontrivial(const value_storage_retaining<U> &o) noexcept(std::is_nothrow_constructible<value_type, U>::value)
+        : value_storage_nontrivial((o._status & status_have_value) != 0 ? value_storage_nontrivial(in_place_type<value_type>, o._value) : value_storage_nontrivial())
+    {
+      _status = o._status;
+    }
+    OUTCOME_TEMPLATE(class U)
+    OUTCOME_TREQUIRES(OUTCOME_TPRED(enable_converting_constructor<U>))
+    constexpr explicit value_storage_nontrivial(value_storage_retaining<U> &&o) noexcept(std::is_nothrow_constructible<value_type, U>::value)
+        : value_storage_nontrivial((o._status & status_have_value) != 0 ? value_storage_nontrivial(in_place_type<value_type>, std::move(o._value)) : value_storage_nontrivial())
+    {
+      _status = o._status;
+    }
     ~value_storage_nontrivial() noexcept(std::is_nothrow_destructible<T>::value)
     {
       if(this->_status & status_have_value)
@@ -230,37 +308,269 @@ namespace detail
         this->_status &= ~status_have_value;
       }
     }
-    constexpr void swap(value_storage_nontrivial &o)
+    // Replaces any value with one constructed in place. Args must not refer to the value being replaced.
+    template <class... Args> void emplace(Args &&... args) noexcept(std::is_nothrow_constructible<value_type, Args...>::value &&std::is_nothrow_destructible<value_type>::value)
     {
-      using std::swap;
-      if((_status & status_have_value) == 0 && (o._status & status_have_value) == 0)
+      reset();
+      new(&_value) value_type(std::forward<Args>(args)...);  // NOLINT
+      _status |= status_have_value;
+    }
+    void reset() noexcept(std::is_nothrow_destructible<value_type>::value)
+    {
+      if(this->_status & status_have_value)
       {
-        swap(_status, o._status);
-        return;
+        this->_value.~value_type();  // NOLINT
+        this->_status &= ~status_have_value;
       }
-      if((_status & status_have_value) != 0 && (o._status & status_have_value) != 0)
+    }
+    constexpr void swap(value_storage_nontrivial &o) { _swap(o, std::integral_constant<bool, trait::is_trivially_relocatable<value_type>::value>()); }
+
+  private:
+    // Trivially relocatable values are swapped bitwise along with the status, so there is no branching at all
+    void _swap(value_storage_nontrivial &o, std::true_type /*trivially relocatable*/) noexcept
+    {
+      alignas(value_storage_nontrivial) unsigned char temp[sizeof(value_storage_nontrivial)];
+      memcpy(temp, static_cast<const void *>(this), sizeof(temp));
+      memcpy(static_cast<void *>(this), static_cast<const void *>(&o), sizeof(temp));
+      memcpy(static_cast<void *>(&o), temp, sizeof(temp));
+    }
+    void _swap(value_storage_nontrivial &o, std::false_type /*trivially relocatable*/)
+    {
+      using std::swap;
+      const bool mine = (_status & status_have_value) != 0, theirs = (o._status & status_have_value) != 0;
+      if(mine && theirs)
       {
         swap(_value, o._value);  // NOLINT
-        swap(_status, o._status);
-        return;
       }
-      // One must be empty and the other non-empty, so use move construction
-      if((_status & status_have_value) != 0)
+      else if(mine != theirs)
       {
-        // Move construct me into other
-        new(&o._value) value_type(std::move(_value));  // NOLINT
-        this->_value.~value_type();                    // NOLINT
-        swap(_status, o._status);
+        // One must be empty and the other non-empty, so move construct the valued one into the other
+        value_storage_nontrivial &from = mine ? *this : o, &to = mine ? o : *this;
+        new(&to._value) value_type(std::move(from._value));  // NOLINT
+        from._value.~value_type();                           // NOLINT
+      }
+      swap(_status, o._status);
+    }
+  };
+  // Clears a retained value, keeping any capacity it owns if it has a clear()
+  template <class T> inline auto clear_retained_value(T &v, int /*unused*/) noexcept(noexcept(v.clear())) -> decltype(v.clear()) { v.clear(); }
+  template <class T> inline void clear_retained_value(T &v, long /*unused*/) { v = T(); }
+  template <class T, class... Args> struct is_single_assignable : std::false_type
+  {
+  };
+  template <class T, class Arg> struct is_single_assignable<T, Arg> : std::is_assignable<T &, Arg>
+  {
+  };
+  // Used if trait::retain_value_storage<T>. The value is always constructed, and is cleared rather than destroyed
+  // whenever there is no value, so whatever capacity it owns is reused when it next becomes valued.
+  template <class T> struct value_storage_retaining
+  {
+    using value_type = T;
+    value_type _value;
+    status_bitfield_type _status{0};
+    value_storage_retaining() noexcept(std::is_nothrow_default_constructible<value_type>::value) : _value() {}
+    value_storage_retaining(const value_storage_retaining &) = default;  // NOLINT
+    value_storage_retaining(value_storage_retaining &&) = default;       // NOLINT
+    // Assigning an unvalued state clears my value rather than replacing it, which would free its capacity
+    value_storage_retaining &operator=(const value_storage_retaining &o)
+    {
+      if((o._status & status_have_value) != 0)
+      {
+        _value = o._value;
       }
       else
       {
-        // Move construct other into me
-        new(&_value) value_type(std::move(o._value));  // NOLINT
-        o._value.~value_type();                        // NOLINT
-        swap(_status, o._status);
+        reset();
+      }
+      _status = o._status;
+      return *this;
+    }
+    value_storage_retaining &operator=(value_storage_retaining &&o) noexcept(std::is_nothrow_move_assignable<value_type>::value &&noexcept(clear_retained_value(std::declval<value_type &>(), 0)))  // NOLINT
+    {
+      if((o._status & status_have_value) != 0)
+      {
+        _value = std::move(o._value);
+      }
+      else
+      {
+        reset();
+      }
+      _status = o._status;
+      return *this;
+    }
+    ~value_storage_retaining() = default;
+    // Special from-void constructor, constructs default T
+    explicit value_storage_retaining(const value_storage_trivial<void> &o) noexcept(std::is_nothrow_default_constructible<value_type>::value)
+        : _value()
+        , _status(o._status)
+    {
+    }
+    explicit value_storage_retaining(status_bitfield_type status)
+        : _value()
+        , _status(status)
+    {
+    }
+    template <class... Args>
+    explicit value_storage_retaining(in_place_type_t<value_type> /*unused*/, Args &&... args) noexcept(std::is_nothrow_constructible<value_type, Args...>::value)
+        : _value(std::forward<Args>(args)...)
+        , _status(status_have_value)
+    {
+    }
+    template <class U, class... Args>
+    value_storage_retaining(in_place_type_t<value_type> /*unused*/, std::initializer_list<U> il, Args &&... args) noexcept(std::is_nothrow_constructible<value_type, std::initializer_list<U>, Args...>::value)
+        : _value(il, std::forward<Args>(args)...)
+        , _status(status_have_value)
+    {
+    }
+    template <class U> static constexpr bool enable_converting_constructor = !std::is_same<std::decay_t<U>, value_type>::value && std::is_constructible<value_type, U>::value;
+    OUTCOME_TEMPLATE(class U)
+    OUTCOME_TREQUIRES(OUTCOME_TPRED(enable_converting_constructor<U>))
+    constexpr explicit value_storage_retaining(const value_storage_trivial<U> &o) noexcept(std::is_nothrow_constructible<value_type, U>::value)
+        : _value((o._status & status_have_value) != 0 ? value_type(o._value) : value_type())
+        , _status(o._status)
+    {
+    }
+    OUTCOME_TEMPLATE(class U)
+    OUTCOME_TREQUIRES(OUTCOME_TPRED(enable_converting_constructor<U>))
+    constexpr explicit value_storage_retaining(value_storage_trivial<U> &&o) noexcept(std::is_nothrow_constructible<value_type, U>::value)
+        : _value((o._status & status_have_value) != 0 ? value_type(std::move(o._value)) : value_type())
+        , _status(o._status)
+    {
+    }
+    OUTCOME_TEMPLATE(class U)
+    OUTCOME_TREQUIRES(OUTCOME_TPRED(enable_converting_constructor<U>))
+    constexpr explicit value_storage_retaining(const value_storage_nontrivial<U> &o) noexcept(std::is_nothrow_constructible<value_type, U>::value)
+        : _value((o._status & status_have_value) != 0 ? value_type(o._value) : value_type())
+        , _status(o._status)
+    {
+    }
+    OUTCOME_TEMPLATE(class U)
+    OUTCOME_TREQUIRES(OUTCOME_TPRED(enable_converting_constructor<U>))
+    constexpr explicit value_storage_retaining(value_storage_nontrivial<U> &&o) noexcept(std::is_nothrow_constructible<value_type, U>::value)
+        : _value((o._status & status_have_value) != 0 ? value_type(std::move(o._value)) : value_type())
+        , _status(o._status)
+    {
+    }
+    OUTCOME_TEMPLATE(class U)
+    OUTCOME_TREQUIRES(OUTCOME_TPRED(enable_converting_constructor<U>))
+    constexpr explicit value_storage_retaining(const value_storage_retaining<U> &o) noexcept(std::is_nothrow_constructible<value_type, U>::value)
+        : _value((o._status & status_have_value) != 0 ? value_type(o._value) : value_type())
+        , _status(o._status)
+    {
+    }
+    OUTCOME_TEMPLATE(class U)
+    OUTCOME_TREQUIRES(OUTCOME_TPRED(enable_converting_constructor<U>))
+    constexpr explicit value_storage_retaining(value_storage_retaining<U> &&o) noexcept(std::is_nothrow_constructible<value_type, U>::value)
+        : _value((o._status & status_have_value) != 0 ? value_type(std::move(o._value)) : value_type())
+        , _status(o._status)
+    {
+    }
+    // Replaces any value. With no args the retained value is left cleared, with one assignable arg the value is
+    // assigned from it, both of which keep its capacity. Args must not refer to the value being replaced.
+    template <class... Args> void emplace(Args &&... args)
+    {
+      _emplace(std::integral_constant<int, (sizeof...(Args) == 0) ? 0 : is_single_assignable<value_type, Args...>::value ? 1 : 2>(), std::forward<Args>(args)...);
+      _status |= status_have_value;
+    }
+    void reset() noexcept(noexcept(clear_retained_value(std::declval<value_type &>(), 0)))
+    {
+      if((_status & status_have_value) != 0)
+      {
+        clear_retained_value(_value, 0);
+        _status &= ~status_have_value;
+      }
+    }
+    void swap(value_storage_retaining &o)
+    {
+      using std::swap;
+      swap(_value, o._value);
+      swap(_status, o._status);
+    }
+
+  private:
+    void _emplace(std::integral_constant<int, 0> /*unused*/) { reset(); }
+    template <class Arg> void _emplace(std::integral_constant<int, 1> /*unused*/, Arg &&arg) { _value = std::forward<Arg>(arg); }
+    template <class... Args> void _emplace(std::integral_constant<int, 2> /*unused*/, Args &&... args) { _value = value_type(std::forward<Args>(args)...); }
+  };
+  // We don't actually need all of std::is_trivial<>, std::is_trivially_copyable<> is sufficient
+  template <class T> using value_storage_select_trivality = std::conditional_t<std::is_trivially_copyable<devoid<T>>::value, value_storage_trivial<T>, value_storage_nontrivial<T>>;
+#if OUTCOME_USE_CXX20_CONCEPTS && __cpp_concepts >= 202002L
+  // Conditionally trivial special member functions let one class do the work of the five layers of wrapper classes below
+  template <class Base> struct value_storage_select_special : Base  // NOLINT
+  {
+    using Base::Base;
+    using value_type = typename Base::value_type;
+    value_storage_select_special() = default;
+    value_storage_select_special(const value_storage_select_special &) requires(std::is_copy_constructible<devoid<value_type>>::value) = default;
+    value_storage_select_special(const value_storage_select_special &) requires(!std::is_copy_constructible<devoid<value_type>>::value) = delete;
+    value_storage_select_special(value_storage_select_special &&) requires(std::is_move_constructible<devoid<value_type>>::value) = default;  // NOLINT
+    value_storage_select_special(value_storage_select_special &&) requires(!std::is_move_constructible<devoid<value_type>>::value) = delete;
+    value_storage_select_special &operator=(const value_storage_select_special &) requires(std::is_trivially_copy_assignable<devoid<value_type>>::value) = default;
+    value_storage_select_special &operator=(const value_storage_select_special &) requires(!std::is_copy_assignable<devoid<value_type>>::value) = delete;
+    value_storage_select_special &operator=(const value_storage_select_special &o) noexcept(std::is_nothrow_copy_assignable<value_type>::value)  //
+    requires(!std::is_trivially_copy_assignable<devoid<value_type>>::value && std::is_copy_assignable<devoid<value_type>>::value)
+    {
+      if((this->_status & status_have_value) != 0 && (o._status & status_have_value) != 0)
+      {
+        this->_value = o._value;  // NOLINT
+      }
+      else if((this->_status & status_have_value) != 0 && (o._status & status_have_value) == 0)
+      {
+        this->_value.~value_type();  // NOLINT
+      }
+      else if((this->_status & status_have_value) == 0 && (o._status & status_have_value) != 0)
+      {
+        new(&this->_value) value_type(o._value);  // NOLINT
+      }
+      this->_status = o._status;
+      return *this;
+    }
+    // If not move assignable, there is no move assignment, so rvalues are copy assigned
+    value_storage_select_special &operator=(value_storage_select_special &&) requires(std::is_trivially_move_assignable<devoid<value_type>>::value) = default;  // NOLINT
+    value_storage_select_special &operator=(value_storage_select_special &&o) noexcept(std::is_nothrow_move_assignable<value_type>::value)                      // NOLINT
+    requires(!std::is_trivially_move_assignable<devoid<value_type>>::value && std::is_move_assignable<devoid<value_type>>::value)
+    {
+      _assign(std::move(o), std::integral_constant<bool, std::is_nothrow_move_constructible<value_type>::value && std::is_nothrow_destructible<value_type>::value>());
+      this->_status = o._status;
+      return *this;
+    }
+    ~value_storage_select_special() = default;
+
+  private:
+    // If moves cannot throw, destroy any value of mine and move construct any value of theirs, which is two independent tests rather than a three way chain
+    void _assign(value_storage_select_special &&o, std::true_type /*nothrow move*/) noexcept
+    {
+      if(this == &o)
+      {
+        return;
+      }
+      if((this->_status & status_have_value) != 0)
+      {
+        this->_value.~value_type();  // NOLINT
+      }
+      if((o._status & status_have_value) != 0)
+      {
+        new(&this->_value) value_type(std::move(o._value));  // NOLINT
+      }
+    }
+    void _assign(value_storage_select_special &&o, std::false_type /*nothrow move*/) noexcept(std::is_nothrow_move_assignable<value_type>::value)
+    {
+      if((this->_status & status_have_value) != 0 && (o._status & status_have_value) != 0)
+      {
+        this->_value = std::move(o._value);  // NOLINT
+      }
+      else if((this->_status & status_have_value) != 0 && (o._status & status_have_value) == 0)
+      {
+        this->_value.~value_type();  // NOLINT
+      }
+      else if((this->_status & status_have_value) == 0 && (o._status & status_have_value) != 0)
+      {
+        new(&this->_value) value_type(std::move(o._value));  // NOLINT
       }
     }
   };
+  template <class T> using value_storage_select_impl = std::conditional_t<trait::retain_value_storage<T>::value, value_storage_retaining<T>, value_storage_select_special<value_storage_select_trivality<T>>>;
+#else
   template <class Base> struct value_storage_delete_copy_constructor : Base  // NOLINT
   {
     using Base::Base;
@@ -306,6 +616,30 @@ namespace detail
     value_storage_nontrivial_move_assignment(value_storage_nontrivial_move_assignment &&) = default;  // NOLINT
     value_storage_nontrivial_move_assignment &operator=(const value_storage_nontrivial_move_assignment &o) = default;
     value_storage_nontrivial_move_assignment &operator=(value_storage_nontrivial_move_assignment &&o) noexcept(std::is_nothrow_move_assignable<value_type>::value)  // NOLINT
+    {
+      _assign(std::move(o), std::integral_constant<bool, std::is_nothrow_move_constructible<value_type>::value && std::is_nothrow_destructible<value_type>::value>());
+      this->_status = o._status;
+      return *this;
+    }
+
+  private:
+    // If moves cannot throw, destroy any value of mine and move construct any value of theirs, which is two independent tests rather than a three way chain
+    void _assign(value_storage_nontrivial_move_assignment &&o, std::true_type /*nothrow move*/) noexcept
+    {
+      if(this == &o)
+      {
+        return;
+      }
+      if((this->_status & status_have_value) != 0)
+      {
+        this->_value.~value_type();  // NOLINT
+      }
+      if((o._status & status_have_value) != 0)
+      {
+        new(&this->_value) value_type(std::move(o._value));  // NOLINT
+      }
+    }
+    void _assign(value_storage_nontrivial_move_assignment &&o, std::false_type /*nothrow move*/) noexcept(std::is_nothrow_move_assignable<value_type>::value)
     {
       if((this->_status & status_have_value) != 0 && (o._status & status_have_value) != 0)
       {
@@ -319,8 +653,6 @@ namespace detail
       {
         new(&this->_value) value_type(std::move(o._value));  // NOLINT
       }
-      this->_status = o._status;
-      return *this;
     }
   };
   template <class Base> struct value_storage_nontrivial_copy_assignment : Base  // NOLINT
@@ -350,8 +682,6 @@ namespace detail
     }
   };
 
-  // We don't actually need all of std::is_trivial<>, std::is_trivially_copyable<> is sufficient
-  template <class T> using value_storage_select_trivality = std::conditional_t<std::is_trivially_copyable<devoid<T>>::value, value_storage_trivial<T>, value_storage_nontrivial<T>>;
   template <class T> using value_storage_select_move_constructor = std::conditional_t<std::is_move_constructible<devoid<T>>::value, value_storage_select_trivality<T>, value_storage_delete_move_constructor<value_storage_select_trivality<T>>>;
   template <class T> using value_storage_select_copy_constructor = std::conditional_t<std::is_copy_constructible<devoid<T>>::value, value_storage_select_move_constructor<T>, value_storage_delete_copy_constructor<value_storage_select_move_constructor<T>>>;
   template <class T>
@@ -360,7 +690,8 @@ namespace detail
   template <class T>
   using value_storage_select_copy_assignment = std::conditional_t<std::is_trivially_copy_assignable<devoid<T>>::value, value_storage_select_move_assignment<T>,
                                                                   std::conditional_t<std::is_copy_assignable<devoid<T>>::value, value_storage_nontrivial_copy_assignment<value_storage_select_move_assignment<T>>, value_storage_delete_copy_assignment<value_storage_select_move_assignment<T>>>>;
-  template <class T> using value_storage_select_impl = value_storage_select_copy_assignment<T>;
+  template <class T> using value_storage_select_impl = std::conditional_t<trait::retain_value_storage<T>::value, value_storage_retaining<T>, value_storage_select_copy_assignment<T>>;
+#endif
 #ifndef NDEBUG
   // Check is trivial in all ways except default constructibility
   // static_assert(std::is_trivial<value_storage_select_impl<int>>::value, "value_storage_select_impl<int> is not trivial!");
@@ -377,6 +708,44 @@ namespace detail
 #endif
 }  // namespace detail
 
+namespace trait
+{
+  // Storage is trivially relocatable if the type stored is, irrespective of how its special member functions are implemented
+  template <class T> struct is_trivially_relocatable<OUTCOME_V2_NAMESPACE::detail::value_storage_trivial<T>> : is_trivially_relocatable<T>
+  {
+  };
+  template <class T> struct is_trivially_relocatable<OUTCOME_V2_NAMESPACE::detail::value_storage_nontrivial<T>> : is_trivially_relocatable<T>
+  {
+  };
+  template <class T> struct is_trivially_relocatable<OUTCOME_V2_NAMESPACE::detail::value_storage_retaining<T>> : is_trivially_relocatable<T>
+  {
+  };
+#if OUTCOME_USE_CXX20_CONCEPTS && __cpp_concepts >= 202002L
+  template <class Base> struct is_trivially_relocatable<OUTCOME_V2_NAMESPACE::detail::value_storage_select_special<Base>> : is_trivially_relocatable<Base>
+  {
+  };
+#else
+  template <class Base> struct is_trivially_relocatable<OUTCOME_V2_NAMESPACE::detail::value_storage_delete_copy_constructor<Base>> : is_trivially_relocatable<Base>
+  {
+  };
+  template <class Base> struct is_trivially_relocatable<OUTCOME_V2_NAMESPACE::detail::value_storage_delete_copy_assignment<Base>> : is_trivially_relocatable<Base>
+  {
+  };
+  template <class Base> struct is_trivially_relocatable<OUTCOME_V2_NAMESPACE::detail::value_storage_delete_move_assignment<Base>> : is_trivially_relocatable<Base>
+  {
+  };
+  template <class Base> struct is_trivially_relocatable<OUTCOME_V2_NAMESPACE::detail::value_storage_delete_move_constructor<Base>> : is_trivially_relocatable<Base>
+  {
+  };
+  template <class Base> struct is_trivially_relocatable<OUTCOME_V2_NAMESPACE::detail::value_storage_nontrivial_move_assignment<Base>> : is_trivially_relocatable<Base>
+  {
+  };
+  template <class Base> struct is_trivially_relocatable<OUTCOME_V2_NAMESPACE::detail::value_storage_nontrivial_copy_assignment<Base>> : is_trivially_relocatable<Base>
+  {
+  };
+#endif
+}  // namespace trait
+
 OUTCOME_V2_NAMESPACE_END
 
 #endif
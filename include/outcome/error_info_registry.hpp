@@ -0,0 +1,285 @@
+/* A lock free, cross thread registry of extended error information
+(C) 2026 agent <agent@local> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_ERROR_INFO_REGISTRY_HPP
+#define OUTCOME_ERROR_INFO_REGISTRY_HPP
+
+#include "result.hpp"
+
+#include <atomic>
+#include <cstddef>  // for size_t
+#include <new>      // for placement new
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdocumentation"  // Standardese markup confuses clang
+#endif
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+namespace detail
+{
+  template <size_t N> struct error_info_registry_log2
+  {
+    static constexpr size_t value = 1 + error_info_registry_log2<N / 2>::value;
+  };
+  template <> struct error_info_registry_log2<1>
+  {
+    static constexpr size_t value = 0;
+  };
+}  // namespace detail
+
+/*! A fixed size, lock free slab of extended error information records which can be
+written by one thread and read by any other thread.
+
+\tparam T The type of extended error information kept. Must be nothrow destructible.
+\tparam Slots The number of records kept. Must be a power of two between 2 and 4096.
+
+Records are claimed round robin, overwriting the oldest record, and are addressed
+by a generation tagged handle. Stale handles, i.e. those whose record has since been
+reused, are detected and refused. The full `handle_type` carries a 16 bit generation,
+the `short_handle_type` carries only as many generation bits as will fit next to the
+slot index in the 16 bits of spare storage in `result`/`outcome`.
+
+While a record is being read it is pinned, and writers skip pinned records rather than
+waiting for them. Writers never block readers, readers never block writers, and neither
+ever takes a lock.
+*/
+template <class T, size_t Slots = 1024> class error_info_registry
+{
+  static_assert(Slots >= 2 && Slots <= 4096 && (Slots & (Slots - 1)) == 0, "Slots must be a power of two between 2 and 4096");
+  static_assert(std::is_nothrow_destructible<T>::value, "T must be nothrow destructible");
+
+public:
+  //! The type of extended error information kept
+  using value_type = T;
+  //! The full handle type, containing a 16 bit generation and the slot index
+  using handle_type = uint32_t;
+  //! The short handle type, suitable for storing in the spare storage of `result`/`outcome`
+  using short_handle_type = uint16_t;
+  //! The number of records kept
+  static constexpr size_t slots = Slots;
+
+private:
+  static constexpr uint32_t _index_bits = detail::error_info_registry_log2<Slots>::value;
+  static constexpr uint32_t _tag_mask = (1U << (16U - _index_bits)) - 1U;
+  // Slot state layout: bits 0-15 generation, bit 16 valid, bit 17 writing, bits 18-31 reader count
+  static constexpr uint32_t _generation_mask = 0xffffU;
+  static constexpr uint32_t _valid = (1U << 16U);
+  static constexpr uint32_t _writing = (1U << 17U);
+  static constexpr uint32_t _reader_one = (1U << 18U);
+  static constexpr uint32_t _readers_mask = ~(_reader_one - 1U);
+
+  struct _slot
+  {
+    std::atomic<uint32_t> state{0};
+    alignas(T) unsigned char storage[sizeof(T)]{};
+    T *value() noexcept { return reinterpret_cast<T *>(storage); }                    // NOLINT
+    const T *value() const noexcept { return reinterpret_cast<const T *>(storage); }  // NOLINT
+  };
+  mutable _slot _slots[Slots];
+  std::atomic<uint32_t> _next{0};
+
+  // Generations are never such that their short handle tag is zero, so no handle is ever zero
+  static constexpr uint32_t _next_generation(uint32_t g) noexcept
+  {
+    g = (g + 1) & _generation_mask;
+    while((g & _tag_mask) == 0)
+    {
+      g = (g + 1) & _generation_mask;
+    }
+    return g;
+  }
+  // Pins the slot for reading if its generation matches, returning the pinned slot or null
+  _slot *_pin(uint32_t index, uint32_t generation, uint32_t generation_mask) const noexcept
+  {
+    _slot &s = _slots[index];
+    uint32_t state = s.state.load(std::memory_order_acquire);
+    do
+    {
+      if((state & (_valid | _writing)) != _valid || (state & generation_mask) != generation || (state & _readers_mask) == _readers_mask)
+      {
+        return nullptr;
+      }
+    } while(!s.state.compare_exchange_weak(state, state + _reader_one, std::memory_order_acquire, std::memory_order_acquire));
+    return &s;
+  }
+  static void _unpin(_slot *s) noexcept { s->state.fetch_sub(_reader_one, std::memory_order_release); }
+  template <class F> static bool _visit(_slot *s, F &&f)
+  {
+    if(s == nullptr)
+    {
+      return false;
+    }
+    struct unpinner
+    {
+      _slot *s;
+      ~unpinner() { _unpin(s); }
+    } _{s};
+    f(*static_cast<const T *>(s->value()));
+    return true;
+  }
+
+public:
+  //! Default constructor. Every member is value initialised, so a registry of any storage duration starts empty.
+  constexpr error_info_registry() noexcept {}  // NOLINT
+  error_info_registry(const error_info_registry &) = delete;
+  error_info_registry(error_info_registry &&) = delete;
+  error_info_registry &operator=(const error_info_registry &) = delete;
+  error_info_registry &operator=(error_info_registry &&) = delete;
+  ~error_info_registry()
+  {
+    for(auto &s : _slots)
+    {
+      if((s.state.load(std::memory_order_acquire) & _valid) != 0)
+      {
+        s.value()->~T();
+      }
+    }
+  }
+
+  /*! Claims the oldest unpinned record and constructs a `T` into it.
+  \returns The handle of the newly constructed record, or zero if every record was pinned by readers.
+  \param args Arguments with which to in place construct the `T`.
+
+  \effects Up to `Slots` records are tried round robin. The first which is neither being read
+  nor written has any previous `T` destroyed, its generation incremented, and a new `T`
+  constructed in place. If construction throws, the record is left empty and the exception propagates.
+  \throws Anything which the constructor of `T` might throw.
+  */
+  template <class... Args> handle_type emplace(Args &&... args)
+  {
+    for(size_t n = 0; n < Slots; n++)
+    {
+      const uint32_t index = _next.fetch_add(1, std::memory_order_relaxed) & (Slots - 1);
+      _slot &s = _slots[index];
+      uint32_t state = s.state.load(std::memory_order_relaxed);
+      if((state & (_writing | _readers_mask)) != 0)
+      {
+        continue;
+      }
+      const uint32_t generation = _next_generation(state & _generation_mask);
+      // Acquire so that any reads of the previous T by now unpinned readers happen before we destroy it
+      if(!s.state.compare_exchange_strong(state, generation | _writing, std::memory_order_acquire, std::memory_order_relaxed))
+      {
+        continue;
+      }
+      if((state & _valid) != 0)
+      {
+        s.value()->~T();
+      }
+      struct unclaimer
+      {
+        _slot *s;
+        uint32_t state;
+        ~unclaimer()
+        {
+          if(s != nullptr)
+          {
+            s->state.store(state, std::memory_order_release);
+          }
+        }
+      } _{&s, generation};
+      new(s.storage) T(std::forward<Args>(args)...);
+      _.s = nullptr;
+      s.state.store(generation | _valid, std::memory_order_release);
+      return (generation << 16U) | index;
+    }
+    return 0;
+  }
+
+  //! Returns the short handle equivalent of a full handle, suitable for storing in 16 bits.
+  static constexpr short_handle_type to_short_handle(handle_type h) noexcept { return static_cast<short_handle_type>((((h >> 16U) & _tag_mask) << _index_bits) | (h & (Slots - 1))); }
+
+  /*! Pins the record referred to by the handle and calls a callable with it.
+  \returns True if the handle was not stale and the callable was called.
+  \param h The handle of the record.
+  \param f A callable to be called with a `const T &`. The record cannot be reused until it returns.
+  */
+  template <class F> bool visit(handle_type h, F &&f) const
+  {
+    if(h == 0)
+    {
+      return false;
+    }
+    return _visit(_pin(h & (Slots - 1), h >> 16U, _generation_mask), std::forward<F>(f));
+  }
+  /*! Pins the record referred to by the short handle and calls a callable with it.
+  \returns True if the short handle was not stale and the callable was called.
+  \param h The short handle of the record.
+  \param f A callable to be called with a `const T &`. The record cannot be reused until it returns.
+
+  Only as many bits of generation as fit in the short handle are compared, so a short handle
+  is seen as stale only whilst fewer than `(65536 / Slots) - 1` generations of its record have passed.
+  */
+  template <class F> bool visit_short(short_handle_type h, F &&f) const
+  {
+    if(h == 0)
+    {
+      return false;
+    }
+    return _visit(_pin(h & (Slots - 1), static_cast<uint32_t>(h) >> _index_bits, _tag_mask), std::forward<F>(f));
+  }
+  //! Copies out the record referred to by the handle, returning false if the handle is stale.
+  bool get(handle_type h, T &out) const
+  {
+    return visit(h, [&out](const T &v) { out = v; });
+  }
+
+  /*! Constructs a new record and writes its short handle into the spare storage of a `result` or `outcome`.
+  \returns The full handle of the newly constructed record, or zero if no record could be claimed,
+  in which case the spare storage is left untouched.
+  \param r The `result` or `outcome` to attach the record to, typically from within a construction hook.
+  \param args Arguments with which to in place construct the `T`.
+  */
+  template <class R, class S, class NoValuePolicy, class... Args> handle_type attach(detail::result_final<R, S, NoValuePolicy> *r, Args &&... args)
+  {
+    handle_type h = emplace(std::forward<Args>(args)...);
+    if(h != 0)
+    {
+      hooks::set_spare_storage(r, to_short_handle(h));
+    }
+    return h;
+  }
+  /*! Pins the record whose short handle is in the spare storage of a `result` or `outcome`, and calls a callable with it.
+  \returns True if a record was attached and not stale, and the callable was called.
+  */
+  template <class R, class S, class NoValuePolicy, class F> bool visit(const detail::result_final<R, S, NoValuePolicy> *r, F &&f) const { return visit_short(hooks::spare_storage(r), std::forward<F>(f)); }
+};
+
+/*! Returns a reference to the process wide registry for the extended error information type `T`.
+*/
+template <class T, size_t Slots = 1024> inline error_info_registry<T, Slots> &global_error_info_registry()
+{
+  static error_info_registry<T, Slots> v;
+  return v;
+}
+
+OUTCOME_V2_NAMESPACE_END
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+
+#endif
@@ -0,0 +1,91 @@
+/* Extern template declarations of common result and outcome specialisations
+(C) 2026 agent <agent@local> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_EXTERN_TEMPLATES_HPP
+#define OUTCOME_EXTERN_TEMPLATES_HPP
+
+#include "outcome.hpp"
+
+#include <string>
+
+/* Include this header in a translation unit to have it use the specialisations of result and
+outcome explicitly instantiated by the `outcome_inst` library, rather than instantiating them
+all over again. You must then link to `outcome_inst`.
+*/
+
+#ifdef OUTCOME_EXTERN_TEMPLATE_LIST_HEADER
+#include OUTCOME_EXTERN_TEMPLATE_LIST_HEADER
+#endif
+#ifndef OUTCOME_EXTERN_TEMPLATE_LIST
+/*! The specialisations to instantiate, as `RESULT(R, S)` and `OUTCOME(R, S, P)` entries, each
+with the default policy. `OUTCOME` entries need an error code `S` and an exception_ptr `P`. The `outcome_inst` library and its consumers must agree on this list,
+which the `OUTCOME_INST_SPECIALISATIONS` cmake variable sets for both by generating the header
+named by `OUTCOME_EXTERN_TEMPLATE_LIST_HEADER`.
+*/
+#define OUTCOME_EXTERN_TEMPLATE_LIST(RESULT, OUTCOME)                                                                                                                                                                                                                                                                          \
+  RESULT(void, std::error_code)                                                                                                                                                                                                                                                                                                \
+  RESULT(int, std::error_code)                                                                                                                                                                                                                                                                                                 \
+  RESULT(std::string, std::error_code)                                                                                                                                                                                                                                                                                         \
+  OUTCOME(void, std::error_code, std::exception_ptr)
+#endif
+
+// Explicit instantiation of a class does not instantiate its bases, so each must be named
+//! \exclude
+#define OUTCOME_EXTERN_TEMPLATE_RESULT_BASES(extern_, R, S, P)                                                                                                                                                                                                                                                                 \
+  extern_ template class OUTCOME_V2_NAMESPACE::detail::result_storage<R, S, OUTCOME_V2_NAMESPACE::detail::extern_template_policy<R, S, P>>;                                                                                                                                                                                    \
+  extern_ template class OUTCOME_V2_NAMESPACE::detail::result_value_observers<OUTCOME_V2_NAMESPACE::detail::result_storage<R, S, OUTCOME_V2_NAMESPACE::detail::extern_template_policy<R, S, P>>, R, OUTCOME_V2_NAMESPACE::detail::extern_template_policy<R, S, P>>;                                                            \
+  extern_ template class OUTCOME_V2_NAMESPACE::detail::result_error_observers<OUTCOME_V2_NAMESPACE::detail::result_value_observers<OUTCOME_V2_NAMESPACE::detail::result_storage<R, S, OUTCOME_V2_NAMESPACE::detail::extern_template_policy<R, S, P>>, R, OUTCOME_V2_NAMESPACE::detail::extern_template_policy<R, S, P>>, S, OUTCOME_V2_NAMESPACE::detail::extern_template_policy<R, S, P>>; \
+  extern_ template class OUTCOME_V2_NAMESPACE::detail::result_final<R, S, OUTCOME_V2_NAMESPACE::detail::extern_template_policy<R, S, P>>;
+//! \exclude
+#define OUTCOME_EXTERN_TEMPLATE_RESULT_IMPL(extern_, R, S) OUTCOME_EXTERN_TEMPLATE_RESULT_BASES(extern_, R, S, void) extern_ template class OUTCOME_V2_NAMESPACE::result<R, S>;
+//! \exclude
+#define OUTCOME_EXTERN_TEMPLATE_OUTCOME_IMPL(extern_, R, S, P)                                                                                                                                                                                                                                                                 \
+  OUTCOME_EXTERN_TEMPLATE_RESULT_BASES(extern_, R, S, P)                                                                                                                                                                                                                                                                       \
+  extern_ template class OUTCOME_V2_NAMESPACE::detail::outcome_exception_observers<OUTCOME_V2_NAMESPACE::detail::result_final<R, S, OUTCOME_V2_NAMESPACE::detail::extern_template_policy<R, S, P>>, R, S, P, OUTCOME_V2_NAMESPACE::detail::extern_template_policy<R, S, P>>;                                                   \
+  static_assert(OUTCOME_V2_NAMESPACE::trait::has_error_code_v<S> && OUTCOME_V2_NAMESPACE::trait::has_exception_ptr_v<P>, "OUTCOME(R, S, P) entries need an error code S and an exception_ptr P");                                                                                                                              \
+  extern_ template class OUTCOME_V2_NAMESPACE::detail::outcome_failure_observers<OUTCOME_V2_NAMESPACE::detail::select_outcome_impl2<R, S, P, OUTCOME_V2_NAMESPACE::detail::extern_template_policy<R, S, P>>, R, S, P, OUTCOME_V2_NAMESPACE::detail::extern_template_policy<R, S, P>>;                                          \
+  extern_ template class OUTCOME_V2_NAMESPACE::outcome<R, S, P>;
+
+//! \exclude
+#define OUTCOME_EXTERN_TEMPLATE_RESULT(R, S) OUTCOME_EXTERN_TEMPLATE_RESULT_IMPL(extern, R, S)
+//! \exclude
+#define OUTCOME_EXTERN_TEMPLATE_OUTCOME(R, S, P) OUTCOME_EXTERN_TEMPLATE_OUTCOME_IMPL(extern, R, S, P)
+//! \exclude
+#define OUTCOME_INSTANTIATE_RESULT(R, S) OUTCOME_EXTERN_TEMPLATE_RESULT_IMPL(, R, S)
+//! \exclude
+#define OUTCOME_INSTANTIATE_OUTCOME(R, S, P) OUTCOME_EXTERN_TEMPLATE_OUTCOME_IMPL(, R, S, P)
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+namespace detail
+{
+  // Lets the macros above name the default policy without a comma in a macro argument
+  template <class R, class S, class P> using extern_template_policy = policy::default_policy<R, S, P>;
+}  // namespace detail
+OUTCOME_V2_NAMESPACE_END
+
+#ifndef OUTCOME_INSTANTIATING_EXTERN_TEMPLATES
+OUTCOME_EXTERN_TEMPLATE_LIST(OUTCOME_EXTERN_TEMPLATE_RESULT, OUTCOME_EXTERN_TEMPLATE_OUTCOME)
+#endif
+
+#endif
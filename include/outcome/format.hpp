@@ -0,0 +1,303 @@
+/* iostream free formatting and serialisation of result and outcome
+(C) 2026 agent <agent@local> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_FORMAT_HPP
+#define OUTCOME_FORMAT_HPP
+
+#include "outcome.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdocumentation"  // Standardese markup confuses clang
+#endif
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+namespace detail
+{
+  // Writes into a caller supplied buffer, truncating as snprintf() does whilst counting what was wanted
+  class format_sink
+  {
+    char *_p, *_end;
+    size_t _needed{0};
+
+  public:
+    format_sink(char *buffer, size_t len) noexcept : _p(buffer), _end((len != 0) ? buffer + len - 1 : buffer) {}
+    void put(const char *s, size_t n) noexcept
+    {
+      const size_t avail = static_cast<size_t>(_end - _p), c = (n < avail) ? n : avail;
+      if(c != 0)
+      {
+        memcpy(_p, s, c);
+        _p += c;
+      }
+      _needed += n;
+    }
+    void put(const char *s) noexcept { put(s, strlen(s)); }
+    template <class... Args> void putf(const char *fmt, Args... args) noexcept
+    {
+      char buffer[64];
+      const int n = snprintf(buffer, sizeof(buffer), fmt, args...);  // NOLINT
+      put(buffer, (n < 0) ? 0 : (static_cast<size_t>(n) < sizeof(buffer)) ? static_cast<size_t>(n) : sizeof(buffer) - 1);
+    }
+    size_t finish(size_t len) noexcept
+    {
+      if(len != 0)
+      {
+        *_p = 0;
+      }
+      return _needed;
+    }
+  };
+
+  // The same text as the default formatting of std::ostream's operator<<
+  inline void format_value(format_sink &s, bool v) { s.put(v ? "1" : "0", 1); }
+  inline void format_value(format_sink &s, char v) { s.put(&v, 1); }
+  inline void format_value(format_sink &s, signed char v) { s.put(reinterpret_cast<const char *>(&v), 1); }    // NOLINT
+  inline void format_value(format_sink &s, unsigned char v) { s.put(reinterpret_cast<const char *>(&v), 1); }  // NOLINT
+  inline void format_value(format_sink &s, short v) { s.putf("%d", static_cast<int>(v)); }
+  inline void format_value(format_sink &s, unsigned short v) { s.putf("%u", static_cast<unsigned>(v)); }
+  inline void format_value(format_sink &s, int v) { s.putf("%d", v); }
+  inline void format_value(format_sink &s, unsigned v) { s.putf("%u", v); }
+  inline void format_value(format_sink &s, long v) { s.putf("%ld", v); }
+  inline void format_value(format_sink &s, unsigned long v) { s.putf("%lu", v); }
+  inline void format_value(format_sink &s, long long v) { s.putf("%lld", v); }
+  inline void format_value(format_sink &s, unsigned long long v) { s.putf("%llu", v); }
+  inline void format_value(format_sink &s, float v) { s.putf("%g", static_cast<double>(v)); }
+  inline void format_value(format_sink &s, double v) { s.putf("%g", v); }
+  inline void format_value(format_sink &s, long double v) { s.putf("%Lg", v); }
+  inline void format_value(format_sink &s, const char *v) { s.put(v); }
+  inline void format_value(format_sink &s, const std::string &v) { s.put(v.data(), v.size()); }
+  inline void format_value(format_sink &s, const std::error_code &v)
+  {
+    s.put(v.category().name());
+    s.putf(":%d", v.value());
+  }
+  OUTCOME_TEMPLATE(class T)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(std::is_enum<T>::value))
+  inline void format_value(format_sink &s, T v) { format_value(s, static_cast<typename std::underlying_type<T>::type>(v)); }
+
+  template <class T> inline void format_message(format_sink & /*unused*/, const T & /*unused*/) {}
+  inline void format_message(format_sink &s, const std::error_code &v)
+  {
+    s.put(" (", 2);
+    const std::string msg(v.message());
+    s.put(msg.data(), msg.size());
+    s.put(")", 1);
+  }
+
+  template <class Impl> inline void format_value_of(format_sink &s, const Impl &v, std::false_type /*void*/) { format_value(s, v.assume_value()); }
+  template <class Impl> inline void format_value_of(format_sink &s, const Impl & /*unused*/, std::true_type /*void*/) { s.put("(+void)"); }
+  template <class Impl> inline void format_error_of(format_sink &s, const Impl &v, std::false_type /*void*/)
+  {
+    format_value(s, v.assume_error());
+    format_message(s, v.assume_error());
+  }
+  template <class Impl> inline void format_error_of(format_sink &s, const Impl & /*unused*/, std::true_type /*void*/) { s.put("(-void)"); }
+  template <class R, class S, class P> inline void format_result(format_sink &s, const result_final<R, S, P> &v)
+  {
+    if(v.has_value())
+    {
+      format_value_of(s, v, std::is_void<R>());
+    }
+    if(v.has_error())
+    {
+      format_error_of(s, v, std::is_void<S>());
+    }
+  }
+  template <class R, class S, class P, class N> inline void format_exception(format_sink &s, const outcome<R, S, P, N> &v)
+  {
+    (void) v;
+#ifdef __cpp_exceptions
+    try
+    {
+      std::rethrow_exception(policy::exception_ptr(v.assume_exception()));
+    }
+    catch(const std::system_error &e)
+    {
+      s.put("std::system_error code ");
+      format_value(s, e.code());
+      s.put(": ");
+      s.put(e.what());
+    }
+    catch(const std::exception &e)
+    {
+      s.put("std::exception: ");
+      s.put(e.what());
+    }
+    catch(...)
+#endif
+    {
+      s.put("unknown exception");
+    }
+  }
+
+  template <class Impl> inline void serialise_value_of(format_sink &s, const Impl &v, std::false_type /*void*/) { format_value(s, v.assume_value()); }
+  template <class Impl> inline void serialise_value_of(format_sink & /*unused*/, const Impl & /*unused*/, std::true_type /*void*/) {}
+  template <class Impl> inline void serialise_error_of(format_sink &s, const Impl &v, std::false_type /*void*/) { format_value(s, v.assume_error()); }
+  template <class Impl> inline void serialise_error_of(format_sink & /*unused*/, const Impl & /*unused*/, std::true_type /*void*/) {}
+  template <class R, class S, class Impl> inline void serialise_result(format_sink &s, const Impl &v)
+  {
+    s.putf("%u ", static_cast<unsigned>(v.__state()._status));
+    if(v.has_value())
+    {
+      serialise_value_of(s, v, std::is_void<R>());
+    }
+    if(v.has_error())
+    {
+      serialise_error_of(s, v, std::is_void<S>());
+    }
+  }
+  template <class F> inline std::string format_to_string(F &&f)
+  {
+    char buffer[128];
+    const size_t n = f(buffer, sizeof(buffer));
+    if(n < sizeof(buffer))
+    {
+      return std::string(buffer, n);
+    }
+    std::string ret(n, 0);
+    f(&ret[0], n + 1);
+    return ret;
+  }
+}  // namespace detail
+
+/*! Debug print a result into a caller supplied buffer, without using iostreams or allocating memory
+(unless the error code's message allocates). Produces the same text as `print()`.
+
+Like `snprintf()`, at most `len - 1` characters are written, the buffer is always zero terminated
+if `len` is not zero, and the number of characters which would have been written is returned.
+\tparam 3
+\exclude
+
+\requires That `R` and `S` are `void`, arithmetic, enumerations, `const char *`, `std::string`
+or `std::error_code`.
+*/
+template <class R, class S, class P> inline size_t print_to(char *buffer, size_t len, const detail::result_final<R, S, P> &v)
+{
+  detail::format_sink s(buffer, len);
+  detail::format_result(s, v);
+  return s.finish(len);
+}
+/*! Debug print an outcome into a caller supplied buffer, without using iostreams or allocating memory
+(unless the error code's message allocates). Produces the same text as `print()`.
+
+Like `snprintf()`, at most `len - 1` characters are written, the buffer is always zero terminated
+if `len` is not zero, and the number of characters which would have been written is returned.
+\tparam 4
+\exclude
+
+\requires That `R` and `S` are `void`, arithmetic, enumerations, `const char *`, `std::string`
+or `std::error_code`.
+*/
+template <class R, class S, class P, class N> inline size_t print_to(char *buffer, size_t len, const outcome<R, S, P, N> &v)
+{
+  detail::format_sink s(buffer, len);
+  const int total = static_cast<int>(v.has_value()) + static_cast<int>(v.has_error()) + static_cast<int>(v.has_exception());
+  if(total > 1)
+  {
+    s.put("{ ", 2);
+  }
+  detail::format_result(s, static_cast<const detail::result_final<R, S, N> &>(v));
+  if(total > 1)
+  {
+    s.put(", ", 2);
+  }
+  if(v.has_exception())
+  {
+    detail::format_exception(s, v);
+  }
+  if(total > 1)
+  {
+    s.put(" }", 2);
+  }
+  return s.finish(len);
+}
+/*! Debug print a result into a string, without using iostreams. Produces the same text as `print()`.
+\tparam 3
+\exclude
+*/
+template <class R, class S, class P> inline std::string to_string(const detail::result_final<R, S, P> &v)
+{
+  return detail::format_to_string([&v](char *buffer, size_t len) { return print_to(buffer, len, v); });
+}
+/*! Debug print an outcome into a string, without using iostreams. Produces the same text as `print()`.
+\tparam 4
+\exclude
+*/
+template <class R, class S, class P, class N> inline std::string to_string(const outcome<R, S, P, N> &v)
+{
+  return detail::format_to_string([&v](char *buffer, size_t len) { return print_to(buffer, len, v); });
+}
+
+/*! Serialise a result into a caller supplied buffer, without using iostreams. Produces the same text as
+`operator<<`, and so may be read back by `operator>>`. Returns as `print_to()` does.
+\tparam 3
+\exclude
+\tparam 4
+\exclude
+
+\requires That `R` and `S` are `void`, arithmetic, enumerations, `const char *`, `std::string`
+or `std::error_code`.
+*/
+template <class R, class S, class P> inline size_t serialise_to(char *buffer, size_t len, const result<R, S, P> &v)
+{
+  detail::format_sink s(buffer, len);
+  detail::serialise_result<R, S>(s, v);
+  return s.finish(len);
+}
+/*! Serialise an outcome into a caller supplied buffer, without using iostreams. Produces the same text as
+`operator<<`, and so may be read back by `operator>>`. Returns as `print_to()` does.
+\tparam 4
+\exclude
+\tparam 5
+\exclude
+\tparam 6
+\exclude
+
+\requires That `R`, `S` and `P` are `void`, arithmetic, enumerations, `const char *`, `std::string`
+or `std::error_code`.
+*/
+template <class R, class S, class P, class N> inline size_t serialise_to(char *buffer, size_t len, const outcome<R, S, P, N> &v)
+{
+  detail::format_sink s(buffer, len);
+  detail::serialise_result<R, S>(s, v);
+  if(v.has_exception())
+  {
+    detail::format_value(s, v.assume_exception());
+  }
+  return s.finish(len);
+}
+
+OUTCOME_V2_NAMESPACE_END
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+
+#endif
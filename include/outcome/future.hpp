@@ -0,0 +1,267 @@
+/* An allocation free promise and future whose shared state is an outcome
+(C) 2026 agent <agent@local> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_FUTURE_HPP
+#define OUTCOME_FUTURE_HPP
+
+#include "atomic_result.hpp"
+#include "outcome.hpp"
+
+#include <exception>  // for terminate
+#include <future>     // for future_errc
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdocumentation"  // Standardese markup confuses clang
+#endif
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+template <class R, class S = std::error_code, class P = std::exception_ptr, class NoValuePolicy = policy::default_policy<R, S, P>> class future_state;
+
+namespace detail
+{
+  // Publish std::future_errc::broken_promise as the error if possible, else as the exception, else there is nothing sensible to do
+  template <class O, class Slot> inline void break_promise(Slot &slot, std::true_type /*error from error_code*/, bool /*unused*/) { slot.emplace(in_place_type<typename O::error_type>, make_error_code(std::future_errc::broken_promise)); }
+#ifdef __cpp_exceptions
+  // Making the exception allocates, so if that fails whatever was thrown is published instead
+  inline std::exception_ptr make_broken_promise_exception() noexcept
+  {
+#if __cplusplus >= 201703L || defined(__GLIBCXX__) || defined(_MSC_VER)
+    // std::future_error's constructor from std::future_errc is standard from C++ 17, and always present in libstdc++ and the MSVC STL
+    try
+    {
+      return std::make_exception_ptr(std::future_error(std::future_errc::broken_promise));
+    }
+    catch(...)
+    {
+      return std::current_exception();
+    }
+#else
+    // Otherwise there is no public constructor, so have the standard library make one, which also allocates a shared state
+    try
+    {
+      std::future<void> f;
+      {
+        std::promise<void> p;
+        f = p.get_future();
+      }
+      f.get();
+    }
+    catch(...)
+    {
+      return std::current_exception();
+    }
+    return {};
+#endif
+  }
+  template <class O, class Slot> inline void break_promise(Slot &slot, std::false_type /*error from error_code*/, std::true_type /*exception from exception_ptr*/) { slot.emplace(in_place_type<typename O::exception_type>, make_broken_promise_exception()); }
+#endif
+  template <class O, class Slot> inline void break_promise(Slot & /*unused*/, std::false_type /*error from error_code*/, ...) { std::terminate(); }
+}  // namespace detail
+
+/*! The producer end of a `future_state`, through which an `outcome<R, S, P, NoValuePolicy>` is published exactly once.
+
+A promise destroyed without having published anything publishes `std::future_errc::broken_promise`, as the
+error if `error_type` is constructible from `std::error_code`, else as the exception if `exception_type` is
+constructible from `std::exception_ptr`, else `std::terminate()` is called. Publishing it as the error is
+allocation free, but publishing it as the exception allocates a `std::future_error`, and if that allocation
+fails, the `std::bad_alloc` is published instead.
+*/
+template <class R, class S = std::error_code, class P = std::exception_ptr, class NoValuePolicy = policy::default_policy<R, S, P>> class promise
+{
+  friend class future_state<R, S, P, NoValuePolicy>;
+
+public:
+  //! The type of outcome published.
+  using outcome_type = outcome<R, S, P, NoValuePolicy>;
+  //! The success type.
+  using value_type = typename outcome_type::value_type;
+  //! The failure type.
+  using error_type = typename outcome_type::error_type;
+  //! The exception type.
+  using exception_type = typename outcome_type::exception_type;
+
+private:
+  future_state<R, S, P, NoValuePolicy> *_state{nullptr};
+
+  explicit promise(future_state<R, S, P, NoValuePolicy> *state) noexcept : _state(state) {}
+  void _break() noexcept
+  {
+    if(_state != nullptr && _state->_slot.is_empty())
+    {
+      detail::break_promise<outcome_type>(_state->_slot, std::is_constructible<error_type, std::error_code>(), std::is_constructible<exception_type, std::exception_ptr>());
+    }
+  }
+
+public:
+  /// \output_section Constructors
+  //! Constructs a promise with no state.
+  promise() = default;
+  promise(const promise &) = delete;
+  //! Move constructor. `o` no longer has a state.
+  promise(promise &&o) noexcept : _state(o._state) { o._state = nullptr; }
+  promise &operator=(const promise &) = delete;
+  //! Move assignment. Breaks my current promise if unfulfilled, then takes the state of `o`.
+  promise &operator=(promise &&o) noexcept
+  {
+    if(this != &o)
+    {
+      _break();
+      _state = o._state;
+      o._state = nullptr;
+    }
+    return *this;
+  }
+  //! Destructor. Breaks the promise if unfulfilled.
+  ~promise() { _break(); }
+
+  //! True if I refer to a shared state.
+  bool valid() const noexcept { return _state != nullptr; }
+
+  /// \output_section Producer
+  /*! Publishes an outcome in place constructed from `args...`, waking any thread waiting on the future.
+  \returns True if this call published the outcome, false if the promise was already fulfilled.
+  \requires `valid()`.
+  \throws Any exception the construction of `outcome_type(Args...)` might throw.
+  */
+  template <class... Args> bool set_outcome(Args &&... args) { return _state->_slot.emplace(std::forward<Args>(args)...); }
+  //! Publishes a successful outcome in place constructed from `args...`. \returns True if this call published the outcome.
+  template <class... Args> bool set_value(Args &&... args) { return _state->_slot.emplace(in_place_type<value_type>, std::forward<Args>(args)...); }
+  //! Publishes an errored outcome in place constructed from `args...`, without any exception. \returns True if this call published the outcome.
+  template <class... Args> bool set_error(Args &&... args) { return _state->_slot.emplace(in_place_type<error_type>, std::forward<Args>(args)...); }
+  //! Publishes an excepted outcome in place constructed from `args...`. \returns True if this call published the outcome.
+  template <class... Args> bool set_exception(Args &&... args) { return _state->_slot.emplace(in_place_type<exception_type>, std::forward<Args>(args)...); }
+};
+
+/*! The consumer end of a `future_state`, from which the published `outcome<R, S, P, NoValuePolicy>` is retrieved.
+*/
+template <class R, class S = std::error_code, class P = std::exception_ptr, class NoValuePolicy = policy::default_policy<R, S, P>> class future
+{
+  friend class future_state<R, S, P, NoValuePolicy>;
+
+public:
+  //! The type of outcome retrieved.
+  using outcome_type = outcome<R, S, P, NoValuePolicy>;
+
+private:
+  future_state<R, S, P, NoValuePolicy> *_state{nullptr};
+
+  explicit future(future_state<R, S, P, NoValuePolicy> *state) noexcept : _state(state) {}
+
+public:
+  /// \output_section Constructors
+  //! Constructs a future with no state.
+  future() = default;
+  future(const future &) = delete;
+  //! Move constructor. `o` no longer has a state.
+  future(future &&o) noexcept : _state(o._state) { o._state = nullptr; }
+  future &operator=(const future &) = delete;
+  //! Move assignment. `o` no longer has a state.
+  future &operator=(future &&o) noexcept
+  {
+    _state = o._state;
+    o._state = nullptr;
+    return *this;
+  }
+  ~future() = default;
+
+  //! True if I refer to a shared state.
+  bool valid() const noexcept { return _state != nullptr; }
+
+  /// \output_section Consumer
+  //! True if the outcome has been published. \requires `valid()`.
+  bool is_ready() const noexcept { return _state->_slot.is_ready(); }
+  /*! Blocks until the outcome has been published.
+  \returns A reference to the published outcome, valid until the shared state is reset or destroyed.
+  \requires `valid()`.
+  */
+  const outcome_type &wait() const noexcept { return _state->_slot.wait(); }
+  /*! Blocks until the outcome has been published, then moves it out.
+  \returns The published outcome.
+  \requires `valid()`.
+  \effects `valid()` becomes false.
+  */
+  outcome_type get() noexcept(std::is_nothrow_move_constructible<outcome_type>::value)
+  {
+    auto *state = _state;
+    _state = nullptr;
+    return std::move(state->_slot.wait());
+  }
+};
+
+/*! The shared state of a `promise` and `future` pair, which unlike that of `std::promise` is never dynamically
+allocated. It lives wherever the caller puts it, on the stack or in a pool, and must outlive both the promise and
+the future retrieved from it.
+
+The `outcome<R, S, P, NoValuePolicy>` is constructed in place within the state and published using an atomic
+state word, upon which the future blocks using a futex on Linux. Errors are transported as `error_type`
+without ever constructing an exception.
+
+\tparam R The `value_type` of the outcome.
+\tparam S The `error_type` of the outcome.
+\tparam P The `exception_type` of the outcome.
+\tparam NoValuePolicy The no value policy of the outcome.
+*/
+template <class R, class S, class P, class NoValuePolicy> class future_state
+{
+  friend class promise<R, S, P, NoValuePolicy>;
+  friend class future<R, S, P, NoValuePolicy>;
+
+public:
+  //! The type of outcome published.
+  using outcome_type = outcome<R, S, P, NoValuePolicy>;
+  //! The promise type.
+  using promise_type = promise<R, S, P, NoValuePolicy>;
+  //! The future type.
+  using future_type = future<R, S, P, NoValuePolicy>;
+
+private:
+  detail::atomic_slot<outcome_type> _slot;
+
+public:
+  /// \output_section Constructors
+  //! Constructs an unfulfilled state.
+  future_state() = default;
+  future_state(const future_state &) = delete;
+  future_state(future_state &&) = delete;
+  future_state &operator=(const future_state &) = delete;
+  future_state &operator=(future_state &&) = delete;
+  ~future_state() = default;
+
+  //! Returns the promise for this state. Call at most once between resets.
+  promise_type get_promise() noexcept { return promise_type(this); }
+  //! Returns the future for this state. Call at most once between resets.
+  future_type get_future() noexcept { return future_type(this); }
+  //! Destroys any outcome published so the state can be reused. There must be no promise or future using it.
+  void reset() noexcept { _slot.reset(); }
+};
+
+OUTCOME_V2_NAMESPACE_END
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+
+#endif
@@ -0,0 +1,323 @@
+/* An exception payload for outcome which stores small exceptions inline
+(C) 2026 agent <agent@local> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_INLINE_EXCEPTION_PTR_HPP
+#define OUTCOME_INLINE_EXCEPTION_PTR_HPP
+
+#include "outcome.hpp"
+
+#include <exception>
+#include <new>
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdocumentation"  // Standardese markup confuses clang
+#endif
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+namespace detail
+{
+  struct inline_exception_vtable
+  {
+    void (*copy)(void *dest, const void *src);
+    void (*move)(void *dest, void *src) noexcept;  // also destroys src
+    void (*destroy)(void *p) noexcept;
+    void (*rethrow)(const void *p);  // never returns
+    std::exception_ptr (*to_exception_ptr)(const void *p);
+    const char *(*what)(const void *p) noexcept;
+    bool (*equal)(const void *a, const void *b) noexcept;  // null if not equality comparable
+    bool is_inline;
+  };
+
+  template <class E> inline const char *inline_exception_what(const E &e, std::true_type /*is std::exception*/) noexcept { return e.what(); }
+  template <class E> inline const char *inline_exception_what(const E & /*unused*/, std::false_type /*is std::exception*/) noexcept { return nullptr; }
+  inline const char *inline_exception_what(const std::exception_ptr &e, std::false_type /*is std::exception*/) noexcept
+  {
+#ifdef __cpp_exceptions
+    try
+    {
+      std::rethrow_exception(e);
+    }
+    catch(const std::exception &x)
+    {
+      return x.what();
+    }
+    catch(...)
+    {
+    }
+#else
+    (void) e;
+#endif
+    return nullptr;
+  }
+
+  template <class E> QUICKCPPLIB_NORETURN inline void inline_exception_rethrow(const E &e)
+  {
+    (void) e;
+    OUTCOME_THROW_EXCEPTION(e);
+  }
+  QUICKCPPLIB_NORETURN inline void inline_exception_rethrow(const std::exception_ptr &e) { std::rethrow_exception(e); }
+
+  template <class E> inline std::exception_ptr inline_exception_to_exception_ptr(const E &e) { return std::make_exception_ptr(e); }
+  inline std::exception_ptr inline_exception_to_exception_ptr(const std::exception_ptr &e) { return e; }
+
+  template <class E> struct inline_exception_thunks
+  {
+    static void copy(void *dest, const void *src) { new(dest) E(*static_cast<const E *>(src)); }
+    static void move(void *dest, void *src) noexcept
+    {
+      E *s = static_cast<E *>(src);
+      new(dest) E(std::move(*s));
+      s->~E();
+    }
+    static void destroy(void *p) noexcept { static_cast<E *>(p)->~E(); }
+    QUICKCPPLIB_NORETURN static void rethrow(const void *p) { inline_exception_rethrow(*static_cast<const E *>(p)); }
+    static std::exception_ptr to_exception_ptr(const void *p) { return inline_exception_to_exception_ptr(*static_cast<const E *>(p)); }
+    static const char *what(const void *p) noexcept { return inline_exception_what(*static_cast<const E *>(p), std::is_base_of<std::exception, E>()); }
+    static bool equal(const void *a, const void *b) noexcept { return *static_cast<const E *>(a) == *static_cast<const E *>(b); }
+
+    template <class T> static constexpr auto equal_thunk(int /*unused*/) -> decltype(std::declval<const T &>() == std::declval<const T &>(), &inline_exception_thunks<T>::equal) { return &inline_exception_thunks<T>::equal; }
+    template <class T> static constexpr decltype(&inline_exception_thunks<T>::equal) equal_thunk(...) { return nullptr; }
+
+    static const inline_exception_vtable *vtable() noexcept
+    {
+      static constexpr inline_exception_vtable v{&copy, &move, &destroy, &rethrow, &to_exception_ptr, &what, equal_thunk<E>(0), !std::is_same<E, std::exception_ptr>::value};
+      return &v;
+    }
+  };
+}  // namespace detail
+
+/*! A nullable exception payload usable as the `P` type of `outcome<R, S, P>`, which stores
+exception types of up to `Bytes` in size inline, and any other exception type inside a
+`std::exception_ptr`.
+
+`std::exception_ptr` is a pointer to a heap allocated, reference counted exception, so every copy
+of an excepted `outcome` performs an atomic increment and every destruction an atomic decrement.
+An exception stored inline is copied by its copy constructor instead, so excepted outcomes can be
+copied and destroyed without the allocation and reference count of a `std::exception_ptr`, at the
+cost of copying the exception itself. This does not avoid any reference counting done by the copy
+constructor of the exception type: `std::runtime_error` and `std::system_error` fit into the default
+size on the major standard libraries, but copying them atomically increments the reference count of
+their shared message string. Only exception types without such shared state, such as one holding
+just an error code, are copied without touching a shared cache line.
+
+An exception type is stored inline if it fits into `Bytes`, requires no more than pointer alignment
+and is nothrow move constructible.
+
+`make_exception_ptr()` is found by ADL, so `policy::exception_ptr()`, `trait::has_exception_ptr_v`
+and all the policies work with this type.
+*/
+template <size_t Bytes = 4 * sizeof(void *)> class inline_exception_ptr
+{
+  static_assert(Bytes >= sizeof(std::exception_ptr), "inline_exception_ptr must be able to hold a std::exception_ptr");
+
+  const detail::inline_exception_vtable *_vt{nullptr};
+  union {
+    char _empty;
+    alignas(void *) unsigned char _buffer[Bytes];
+  };
+
+  template <class E, class... Args> void _construct(std::true_type /*inline*/, Args &&... args)
+  {
+    new(_buffer) E(std::forward<Args>(args)...);
+    _vt = detail::inline_exception_thunks<E>::vtable();
+  }
+  template <class E, class... Args> void _construct(std::false_type /*inline*/, Args &&... args)
+  {
+    new(_buffer) std::exception_ptr(std::make_exception_ptr(E(std::forward<Args>(args)...)));
+    _vt = detail::inline_exception_thunks<std::exception_ptr>::vtable();
+  }
+
+public:
+  //! The number of bytes available for inline storage of an exception
+  static constexpr size_t buffer_size = Bytes;
+  //! True if an exception of type `E` would be stored inline
+  template <class E>
+  struct stores_inline : std::integral_constant<bool, sizeof(E) <= Bytes && alignof(E) <= alignof(void *) && std::is_nothrow_move_constructible<E>::value>
+  {
+  };
+
+  //! Default constructor, constructing an empty instance.
+  constexpr inline_exception_ptr() noexcept
+      : _empty(0)
+  {
+  }
+  //! Constructs an empty instance.
+  constexpr inline_exception_ptr(std::nullptr_t /*unused*/) noexcept  // NOLINT
+      : _empty(0)
+  {
+  }
+  /*! Implicit converting constructor from a `std::exception_ptr`.
+  \effects If `ep` is not null, stores a copy of it.
+  */
+  inline_exception_ptr(std::exception_ptr ep) noexcept  // NOLINT
+      : _empty(0)
+  {
+    if(ep)
+    {
+      new(_buffer) std::exception_ptr(std::move(ep));
+      _vt = detail::inline_exception_thunks<std::exception_ptr>::vtable();
+    }
+  }
+  /*! Explicit inplace constructor of an exception of type `E`.
+  \effects If `stores_inline<E>` is true, constructs an `E` from `args` inline, else
+  stores `std::make_exception_ptr(E(args...))`.
+  \throws Any exception the construction of `E` might throw.
+  */
+  template <class E, class... Args>
+  explicit inline_exception_ptr(in_place_type_t<E> /*unused*/, Args &&... args)
+      : _empty(0)
+  {
+    static_assert(!std::is_reference<E>::value && !std::is_array<E>::value, "E must be an object type");
+    _construct<E>(stores_inline<E>(), std::forward<Args>(args)...);
+  }
+  //! Copy constructor. Throws anything the copy construction of the stored exception might throw.
+  inline_exception_ptr(const inline_exception_ptr &o)
+      : _empty(0)
+  {
+    if(o._vt != nullptr)
+    {
+      o._vt->copy(_buffer, o._buffer);
+      _vt = o._vt;
+    }
+  }
+  //! Move constructor. Leaves the source empty.
+  inline_exception_ptr(inline_exception_ptr &&o) noexcept : _empty(0)
+  {
+    if(o._vt != nullptr)
+    {
+      o._vt->move(_buffer, o._buffer);
+      _vt = o._vt;
+      o._vt = nullptr;
+    }
+  }
+  //! Copy assignment. Throws anything the copy construction of the stored exception might throw, in which case `*this` is unchanged.
+  inline_exception_ptr &operator=(const inline_exception_ptr &o)
+  {
+    if(this != &o)
+    {
+      *this = inline_exception_ptr(o);
+    }
+    return *this;
+  }
+  //! Move assignment. Leaves the source empty.
+  inline_exception_ptr &operator=(inline_exception_ptr &&o) noexcept
+  {
+    if(this != &o)
+    {
+      reset();
+      if(o._vt != nullptr)
+      {
+        o._vt->move(_buffer, o._buffer);
+        _vt = o._vt;
+        o._vt = nullptr;
+      }
+    }
+    return *this;
+  }
+  ~inline_exception_ptr() { reset(); }
+
+  //! Destroys any stored exception, leaving the instance empty.
+  void reset() noexcept
+  {
+    if(_vt != nullptr)
+    {
+      _vt->destroy(_buffer);
+      _vt = nullptr;
+    }
+  }
+  //! Swaps with another instance.
+  void swap(inline_exception_ptr &o) noexcept
+  {
+    inline_exception_ptr temp(std::move(o));
+    o = std::move(*this);
+    *this = std::move(temp);
+  }
+
+  //! True if an exception is stored.
+  explicit operator bool() const noexcept { return _vt != nullptr; }
+  //! True if an exception is stored inline rather than within a `std::exception_ptr`.
+  bool is_inline() const noexcept { return _vt != nullptr && _vt->is_inline; }
+  //! Returns the `what()` of the stored exception, or null if empty or not derived from `std::exception`.
+  const char *what() const noexcept { return (_vt != nullptr) ? _vt->what(_buffer) : nullptr; }
+  /*! Throws a copy of the stored exception, or rethrows the stored `std::exception_ptr`.
+  \requires That an exception is stored.
+  */
+  QUICKCPPLIB_NORETURN void rethrow() const
+  {
+    _vt->rethrow(_buffer);
+    std::terminate();  // unreachable
+  }
+  //! Returns the stored exception as a `std::exception_ptr`, or a null `std::exception_ptr` if empty.
+  std::exception_ptr to_exception_ptr() const { return (_vt != nullptr) ? _vt->to_exception_ptr(_buffer) : std::exception_ptr(); }
+
+  //! ADL discovered by `policy::exception_ptr()` to convert into a `std::exception_ptr`.
+  friend inline std::exception_ptr make_exception_ptr(const inline_exception_ptr &v) { return v.to_exception_ptr(); }
+
+  /*! True if both are empty, or if both store the same type of exception and that type's `operator==` returns true.
+  Stored `std::exception_ptr` compare by identity, as they do normally. Inline exceptions without an `operator==`
+  never compare equal.
+  */
+  friend inline bool operator==(const inline_exception_ptr &a, const inline_exception_ptr &b) noexcept
+  {
+    if(a._vt != b._vt)
+    {
+      return false;
+    }
+    if(a._vt == nullptr)
+    {
+      return true;
+    }
+    return a._vt->equal != nullptr && a._vt->equal(a._buffer, b._buffer);
+  }
+  //! Inverse of `operator==`.
+  friend inline bool operator!=(const inline_exception_ptr &a, const inline_exception_ptr &b) noexcept { return !(a == b); }
+  //! True if empty.
+  friend inline bool operator==(const inline_exception_ptr &a, std::nullptr_t /*unused*/) noexcept { return a._vt == nullptr; }
+  //! True if empty.
+  friend inline bool operator==(std::nullptr_t /*unused*/, const inline_exception_ptr &a) noexcept { return a._vt == nullptr; }
+  //! True if not empty.
+  friend inline bool operator!=(const inline_exception_ptr &a, std::nullptr_t /*unused*/) noexcept { return a._vt != nullptr; }
+  //! True if not empty.
+  friend inline bool operator!=(std::nullptr_t /*unused*/, const inline_exception_ptr &a) noexcept { return a._vt != nullptr; }
+  //! Swaps two instances.
+  friend inline void swap(inline_exception_ptr &a, inline_exception_ptr &b) noexcept { a.swap(b); }
+};
+
+/*! Makes an `inline_exception_ptr` storing an exception of type `E` constructed from `args`.
+\throws Any exception the construction of `E` might throw.
+*/
+template <class E, size_t Bytes = 4 * sizeof(void *), class... Args> inline inline_exception_ptr<Bytes> make_inline_exception_ptr(Args &&... args)
+{
+  return inline_exception_ptr<Bytes>(in_place_type<E>, std::forward<Args>(args)...);
+}
+
+OUTCOME_V2_NAMESPACE_END
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+
+#endif
@@ -27,8 +27,9 @@ http://www.boost.org/LICENSE_1_0.txt)
 
 #include "outcome.hpp"
 
-#include <iostream>
-#include <sstream>
+#include <istream>
+#include <ostream>
+#include <sstream>  // never <iostream>, which adds a static initialiser to every translation unit
 
 OUTCOME_V2_NAMESPACE_BEGIN
 
@@ -59,6 +60,15 @@ namespace detail
     }
     return s;
   }
+  template <class T> inline std::ostream &operator<<(std::ostream &s, const value_storage_retaining<T> &v)
+  {
+    s << v._status << " ";
+    if((v._status & status_have_value) != 0)
+    {
+      s << v._value;  // NOLINT
+    }
+    return s;
+  }
   template <class T> inline std::istream &operator>>(std::istream &s, value_storage_trivial<T> &v)
   {
     v = value_storage_trivial<T>();
@@ -87,6 +97,17 @@ namespace detail
     }
     return s;
   }
+  template <class T> inline std::istream &operator>>(std::istream &s, value_storage_retaining<T> &v)
+  {
+    // Retained values are only ever cleared, never destroyed
+    v.reset();
+    s >> v._status;
+    if((v._status & status_have_value) != 0)
+    {
+      s >> v._value;  // NOLINT
+    }
+    return s;
+  }
   OUTCOME_TEMPLATE(class T)
   OUTCOME_TREQUIRES(OUTCOME_TPRED(!std::is_constructible<std::error_code, T>::value))
   inline std::string safe_message(T && /*unused*/) { return {}; }
@@ -276,7 +297,7 @@ template <class R, class S, class P, class N> inline std::string print(const out
 #ifdef __cpp_exceptions
     try
     {
-      std::rethrow_exception(v.exception());
+      std::rethrow_exception(policy::exception_ptr(v.exception()));
     }
     catch(const std::system_error &e)
     {
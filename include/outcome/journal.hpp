@@ -0,0 +1,457 @@
+/* An append only memory mapped journal of results for replay and offline analysis
+(C) 2026 agent <agent@local> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_JOURNAL_HPP
+#define OUTCOME_JOURNAL_HPP
+
+#include "category_registry.hpp"
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>   // for snprintf
+#include <cstring>  // for memcpy
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdocumentation"  // Standardese markup confuses clang
+#endif
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+/*! The fixed layout of one record in a journal segment, which is read in place from the mapped file.
+*/
+struct journal_record
+{
+  //! `commit_marker` once the record is completely written, else zero.
+  std::atomic<uint32_t> committed;
+  //! The status bitfield of the result, with its spare storage in the top 16 bits.
+  uint32_t status;
+  //! Nanoseconds since the UNIX epoch when the record was appended.
+  uint64_t timestamp;
+  //! The stable id of the category of the error, or zero if there was no error code.
+  uint64_t category;
+  //! The value of the error code.
+  int32_t error_value;
+  //! How many bytes of `payload` are used.
+  uint16_t payload_length;
+  //! True if the payload was truncated to fit.
+  uint16_t payload_truncated;
+  //! The first bytes of any payload supplied.
+  char payload[32];
+
+  //! The value of `committed` for a complete record.
+  static constexpr uint32_t commit_marker = 0x4f4b4f4b;  // "KOKO"
+  //! Bit set in `status` if the result had a value.
+  static constexpr uint32_t status_have_value = 1U << 0U;
+  //! Bit set in `status` if the result had an error.
+  static constexpr uint32_t status_have_error = 1U << 1U;
+  //! Bit set in `status` if the outcome had an exception.
+  static constexpr uint32_t status_have_exception = 1U << 2U;
+  //! Bit set in `status` if the error was in the generic category.
+  static constexpr uint32_t status_error_is_errno = 1U << 4U;
+
+  //! The error code of the record, decoded. \sa `decode_error_code()`.
+  std::error_code error() const noexcept { return decode_error_code({category, error_value}); }
+  //! The spare storage of the result.
+  uint16_t spare_storage() const noexcept { return static_cast<uint16_t>(status >> 16U); }
+};
+static_assert(sizeof(journal_record) == 64, "journal_record is not one cache line");
+
+/*! Appends fixed layout `journal_record`s to a sequence of memory mapped segment files, `journal-NNNNNNNNNNNNNNNN.bin`
+within a directory. Once a segment is full, the next is created and mapped. Segments are never overwritten, so
+a journal reopened in the same directory continues in new segments.
+
+Appending is lock free outside of segment rotation. Each thread reserves a chunk of records in the current segment
+with a single atomic add, and fills it with no further synchronisation; each record is published by writing
+its commit marker last, so a reader, or a post mortem of a crashed process, sees only whole records. Chunks not
+filled by the time their thread stops appending, or starts appending to another journal, are left as uncommitted
+records, which readers skip.
+*/
+class journal_writer
+{
+  struct _segment
+  {
+    int fd{-1};
+    char *addr{nullptr};
+    size_t bytes{0};
+    std::atomic<uint64_t> cursor{0};
+    ~_segment()
+    {
+      if(addr != nullptr)
+      {
+        ::munmap(addr, bytes);
+      }
+      if(fd != -1)
+      {
+        ::close(fd);
+      }
+    }
+  };
+  struct _impl
+  {
+    uint64_t id;
+    std::string dir;
+    uint64_t records_per_segment;
+    uint64_t next_index{0};
+    std::atomic<_segment *> current{nullptr};
+    std::mutex lock;
+    // Old segments remain mapped, as threads may still be filling their chunks in them
+    std::vector<std::unique_ptr<_segment>> segments;
+  };
+  // What each thread is currently filling
+  struct _chunk
+  {
+    uint64_t owner{0};
+    journal_record *next{nullptr}, *end{nullptr};
+  };
+
+  std::unique_ptr<_impl> _p;
+
+  static std::error_code _errno() noexcept { return {errno, std::system_category()}; }
+  static _chunk &_tls() noexcept
+  {
+    static OUTCOME_THREAD_LOCAL _chunk c;
+    return c;
+  }
+
+  // Creates and maps the next unused segment file, unless another thread already replaced the full one
+  result<void> _rotate(_segment *full) noexcept
+  {
+    std::lock_guard<std::mutex> g(_p->lock);
+    if(_p->current.load(std::memory_order_relaxed) != full)
+    {
+      return success();  // someone else already rotated
+    }
+    std::unique_ptr<_segment> s(new(std::nothrow) _segment);
+    if(!s)
+    {
+      return std::make_error_code(std::errc::not_enough_memory);
+    }
+    for(;;)
+    {
+      char path[64];
+      snprintf(path, sizeof(path), "/journal-%016llu.bin", static_cast<unsigned long long>(_p->next_index++));
+      s->fd = ::open((_p->dir + path).c_str(), O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0644);  // NOLINT
+      if(s->fd != -1)
+      {
+        break;
+      }
+      if(errno != EEXIST)
+      {
+        return _errno();
+      }
+    }
+    s->bytes = static_cast<size_t>((_p->records_per_segment + 1) * sizeof(journal_record));
+    if(::ftruncate(s->fd, static_cast<off_t>(s->bytes)) == -1)
+    {
+      return _errno();
+    }
+    void *addr = ::mmap(nullptr, s->bytes, PROT_READ | PROT_WRITE, MAP_SHARED, s->fd, 0);
+    if(addr == MAP_FAILED)  // NOLINT
+    {
+      return _errno();
+    }
+    s->addr = static_cast<char *>(addr);
+    // The first record's worth of the file is the segment header
+    const uint64_t header[4] = {journal_reader_magic(), sizeof(journal_record), _p->records_per_segment, 0};
+    memcpy(s->addr, header, sizeof(header));
+    _p->segments.push_back(std::move(s));
+    _p->current.store(_p->segments.back().get(), std::memory_order_release);
+    return success();
+  }
+  result<journal_record *> _reserve() noexcept
+  {
+    _chunk &c = _tls();
+    if(c.owner == _p->id && c.next != c.end)
+    {
+      return c.next++;
+    }
+    for(;;)
+    {
+      _segment *s = _p->current.load(std::memory_order_acquire);
+      const uint64_t start = s->cursor.fetch_add(chunk_records, std::memory_order_relaxed);
+      if(start < _p->records_per_segment)
+      {
+        auto *records = reinterpret_cast<journal_record *>(s->addr) + 1;  // NOLINT
+        c.owner = _p->id;
+        c.next = records + start + 1;
+        c.end = records + start + chunk_records;
+        return records + start;
+      }
+      auto rotated = _rotate(s);
+      if(!rotated)
+      {
+        return rotated.error();
+      }
+    }
+  }
+  template <class T> static void _fill_error(journal_record &r, const T &o, std::true_type /*has error code*/) noexcept
+  {
+    const std::error_code ec = policy::error_code(o.assume_error());
+    auto encoded = encode_error_code(ec);
+    r.category = encoded ? encoded.value().category : 0;
+    r.error_value = ec.value();
+    if(ec.category() == std::generic_category())
+    {
+      r.status |= journal_record::status_error_is_errno;
+    }
+  }
+  template <class T> static void _fill_error(journal_record & /*unused*/, const T & /*unused*/, std::false_type /*has error code*/) noexcept {}
+
+  journal_writer() = default;
+
+public:
+  //! The number of records each thread reserves at a time.
+  static constexpr uint64_t chunk_records = 64;
+  //! The magic number at the start of each segment file.
+  static constexpr uint64_t journal_reader_magic() noexcept { return 0x31306c6e72756a6fULL; }  // "ojurnl01"
+
+  /// \output_section Constructors
+  /*! Creates a journal writing segments into the directory `dir`, which must exist.
+  \returns The writer, or the system error which prevented creating its first segment.
+  \param dir The directory into which to write segments.
+  \param segment_bytes The approximate size of each segment file, rounded to a whole number of chunks.
+  */
+  static result<journal_writer> create(std::string dir, size_t segment_bytes = 64 * 1024 * 1024) noexcept
+  {
+    static std::atomic<uint64_t> ids{0};
+    journal_writer ret;
+    ret._p.reset(new(std::nothrow) _impl);
+    if(!ret._p)
+    {
+      return std::make_error_code(std::errc::not_enough_memory);
+    }
+    ret._p->id = ++ids;
+    ret._p->dir = std::move(dir);
+    const uint64_t chunks = segment_bytes / sizeof(journal_record) / chunk_records;
+    ret._p->records_per_segment = ((chunks > 0) ? chunks : 1) * chunk_records;
+    auto rotated = ret._rotate(nullptr);
+    if(!rotated)
+    {
+      return rotated.error();
+    }
+    return {std::move(ret)};
+  }
+  journal_writer(const journal_writer &) = delete;
+  //! Move constructor.
+  journal_writer(journal_writer &&) = default;
+  journal_writer &operator=(const journal_writer &) = delete;
+  //! Move assignment.
+  journal_writer &operator=(journal_writer &&) = default;
+  //! Unmaps and closes all segments. There must be no concurrent appending.
+  ~journal_writer() = default;
+
+  /*! Appends a record of `r`, which may be any `result` or `outcome`, and of an optional payload.
+  \returns Success, or the system error which prevented rotating to a new segment.
+  \param r The result to record.
+  \param payload Optional bytes to record with it, truncated to `sizeof(journal_record::payload)`.
+  \param payload_length The length of `payload`.
+  */
+  template <class R, class S, class NoValuePolicy> result<void> append(const detail::result_final<R, S, NoValuePolicy> &r, const void *payload = nullptr, size_t payload_length = 0) noexcept
+  {
+    auto reserved = _reserve();
+    if(!reserved)
+    {
+      return reserved.error();
+    }
+    journal_record *rec = reserved.value();
+    rec->status = (static_cast<uint32_t>(hooks::spare_storage(&r)) << 16U) | (r.has_value() ? journal_record::status_have_value : 0) | (r.has_error() ? journal_record::status_have_error : 0) | (r.has_exception() ? journal_record::status_have_exception : 0);
+    rec->timestamp = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+    rec->category = 0;
+    rec->error_value = 0;
+    if(r.has_error())
+    {
+      _fill_error(*rec, r, std::integral_constant<bool, trait::has_error_code_v<S>>());
+    }
+    const size_t length = (payload_length < sizeof(rec->payload)) ? payload_length : sizeof(rec->payload);
+    if(length > 0)
+    {
+      memcpy(rec->payload, payload, length);
+    }
+    rec->payload_length = static_cast<uint16_t>(length);
+    rec->payload_truncated = (length < payload_length) ? 1 : 0;
+    rec->committed.store(journal_record::commit_marker, std::memory_order_release);
+    return success();
+  }
+  //! Schedules all segments to be written to storage.
+  void flush() noexcept
+  {
+    std::lock_guard<std::mutex> g(_p->lock);
+    for(auto &s : _p->segments)
+    {
+      ::msync(s->addr, s->bytes, MS_ASYNC);
+    }
+  }
+};
+
+/*! Maps one segment file of a journal read only, and iterates its committed records in place.
+*/
+class journal_reader
+{
+  int _fd{-1};
+  void *_addr{nullptr};
+  size_t _bytes{0};
+
+  journal_reader() = default;
+
+public:
+  /*! Iterates the committed records of a segment.
+  */
+  class const_iterator
+  {
+    friend class journal_reader;
+    const journal_record *_p{nullptr}, *_end{nullptr};
+
+    const_iterator(const journal_record *p, const journal_record *end) noexcept
+        : _p(p)
+        , _end(end)
+    {
+      _skip();
+    }
+    void _skip() noexcept
+    {
+      while(_p != _end && _p->committed.load(std::memory_order_acquire) != journal_record::commit_marker)
+      {
+        ++_p;
+      }
+    }
+
+  public:
+    using value_type = journal_record;
+    using reference = const journal_record &;
+    using pointer = const journal_record *;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::forward_iterator_tag;
+
+    const_iterator() = default;
+    reference operator*() const noexcept { return *_p; }
+    pointer operator->() const noexcept { return _p; }
+    const_iterator &operator++() noexcept
+    {
+      ++_p;
+      _skip();
+      return *this;
+    }
+    const_iterator operator++(int) noexcept
+    {
+      const_iterator ret(*this);
+      ++*this;
+      return ret;
+    }
+    bool operator==(const const_iterator &o) const noexcept { return _p == o._p; }
+    bool operator!=(const const_iterator &o) const noexcept { return _p != o._p; }
+  };
+
+  /// \output_section Constructors
+  /*! Maps the segment file at `path`.
+  \returns The reader, the system error which prevented mapping, or `errc::invalid_argument` if `path` is not a journal segment.
+  */
+  static result<journal_reader> open(const std::string &path) noexcept
+  {
+    journal_reader ret;
+    ret._fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);  // NOLINT
+    if(ret._fd == -1)
+    {
+      return std::error_code(errno, std::system_category());
+    }
+    struct stat s;  // NOLINT
+    if(::fstat(ret._fd, &s) == -1)
+    {
+      return std::error_code(errno, std::system_category());
+    }
+    if(static_cast<size_t>(s.st_size) < sizeof(journal_record))
+    {
+      return std::make_error_code(std::errc::invalid_argument);
+    }
+    ret._bytes = static_cast<size_t>(s.st_size);
+    ret._addr = ::mmap(nullptr, ret._bytes, PROT_READ, MAP_SHARED, ret._fd, 0);
+    if(ret._addr == MAP_FAILED)  // NOLINT
+    {
+      ret._addr = nullptr;
+      return std::error_code(errno, std::system_category());
+    }
+    const auto *header = static_cast<const uint64_t *>(ret._addr);
+    if(header[0] != journal_writer::journal_reader_magic() || header[1] != sizeof(journal_record) || (header[2] + 1) * sizeof(journal_record) > ret._bytes)
+    {
+      return std::make_error_code(std::errc::invalid_argument);
+    }
+    return {std::move(ret)};
+  }
+  journal_reader(const journal_reader &) = delete;
+  //! Move constructor.
+  journal_reader(journal_reader &&o) noexcept : _fd(o._fd), _addr(o._addr), _bytes(o._bytes)
+  {
+    o._fd = -1;
+    o._addr = nullptr;
+    o._bytes = 0;
+  }
+  journal_reader &operator=(const journal_reader &) = delete;
+  journal_reader &operator=(journal_reader &&) = delete;
+  //! Unmaps the segment.
+  ~journal_reader()
+  {
+    if(_addr != nullptr)
+    {
+      ::munmap(_addr, _bytes);
+    }
+    if(_fd != -1)
+    {
+      ::close(_fd);
+    }
+  }
+
+  //! The first committed record.
+  const_iterator begin() const noexcept
+  {
+    const auto *records = static_cast<const journal_record *>(_addr) + 1;
+    return {records, records + static_cast<const uint64_t *>(_addr)[2]};
+  }
+  //! One past the last record.
+  const_iterator end() const noexcept
+  {
+    const auto *records = static_cast<const journal_record *>(_addr) + 1;
+    return {records + static_cast<const uint64_t *>(_addr)[2], records + static_cast<const uint64_t *>(_addr)[2]};
+  }
+};
+
+OUTCOME_V2_NAMESPACE_END
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+
+#endif  // !_WIN32
+
+#endif
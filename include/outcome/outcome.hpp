@@ -38,13 +38,38 @@ http://www.boost.org/LICENSE_1_0.txt)
 
 OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
 
-template <class R, class S = std::error_code, class P = std::exception_ptr, class NoValuePolicy = policy::default_policy<R, S, P>>  //
-OUTCOME_REQUIRES(detail::type_can_be_used_in_result<P> && (std::is_void<P>::value || std::is_default_constructible<P>::value))      //
+template <class R, class S = std::error_code, class P = std::exception_ptr, class NoValuePolicy = policy::default_policy<R, S, P>>
 class outcome;
 
 namespace detail
 {
   // May be reused by outcome subclasses to save load on the compiler
+#if OUTCOME_USE_CXX20_CONCEPTS
+  template <class value_type, class error_type, class exception_type> struct outcome_predicates;
+
+  // As with result, the converting constructor predicates are concepts when possible, so they stop at the first unsatisfied constraint
+  template <class T, class Self, class value_type, class error_type, class exception_type>
+  concept outcome_value_converting_constructible =                                              //
+  result_value_converting_constructible<T, Self, value_type, error_type>                        //
+  && outcome_predicates<value_type, error_type, exception_type>::implicit_constructors_enabled  //
+  && !detail::is_implicitly_constructible<exception_type, T>;
+  template <class T, class Self, class value_type, class error_type, class exception_type>
+  concept outcome_error_converting_constructible =                                              //
+  result_error_converting_constructible<T, Self, value_type, error_type>                        //
+  && outcome_predicates<value_type, error_type, exception_type>::implicit_constructors_enabled  //
+  && !detail::is_implicitly_constructible<exception_type, T>;
+  template <class ErrorCondEnum, class Self, class value_type, class error_type, class exception_type>
+  concept outcome_error_condition_converting_constructible =                                    //
+  result_error_condition_converting_constructible<ErrorCondEnum, Self, value_type, error_type>  //
+  && !detail::is_implicitly_constructible<exception_type, ErrorCondEnum>;
+  template <class T, class Self, class value_type, class error_type, class exception_type>
+  concept outcome_exception_converting_constructible =                                          //
+  !std::is_same<std::decay_t<T>, Self>::value                                                   // not my type
+  && outcome_predicates<value_type, error_type, exception_type>::implicit_constructors_enabled  //
+  && !is_in_place_type_t<std::decay_t<T>>::value                                                // not in place construction
+  && !detail::is_implicitly_constructible<value_type, T> && !detail::is_implicitly_constructible<error_type, T> && detail::is_implicitly_constructible<exception_type, T>;
+#endif
+
   template <class value_type, class error_type, class exception_type> struct outcome_predicates
   {
     using result = result_predicates<value_type, error_type>;
@@ -86,7 +111,7 @@ namespace detail
     // Predicate for the converting copy constructor from a compatible outcome to be available.
     template <class T, class U, class V, class W>
     static constexpr bool enable_compatible_conversion =                                                                             //
-    (std::is_void<T>::value || detail::is_explicitly_constructible<value_type, typename outcome<T, U, V, W>::value_type>)            // if our value types are constructible
+    (std::is_void<T>::value || detail::is_explicitly_constructible<value_storage_type<value_type>, value_storage_type<typename outcome<T, U, V, W>::value_type>>)  // if our value types are constructible
     &&(std::is_void<U>::value || detail::is_explicitly_constructible<error_type, typename outcome<T, U, V, W>::error_type>)          // if our error types are constructible
     &&(std::is_void<V>::value || detail::is_explicitly_constructible<exception_type, typename outcome<T, U, V, W>::exception_type>)  // if our exception types are constructible
     ;
@@ -119,10 +144,25 @@ namespace detail
   template <class T, class U, class V> constexpr inline V &&extract_exception_from_failure(failure_type<U, V> &&v) { return std::move(v).exception(); }
   template <class T, class U> constexpr inline T extract_exception_from_failure(const failure_type<U, void> & /*unused*/) { return T{}; }
 
-  template <class T> struct is_outcome : std::false_type
+  template <class R, class S, class T, class N> struct is_outcome<outcome<R, S, T, N>> : std::true_type
   {
   };
-  template <class R, class S, class T, class N> struct is_outcome<outcome<R, S, T, N>> : std::true_type
+
+  // The exception type of a result or outcome whose failure is being forwarded
+  template <class T> struct forwarded_exception_type
+  {
+    using type = void;
+  };
+  template <class R, class S, class P, class N> struct forwarded_exception_type<outcome<R, S, P, N>>
+  {
+    using type = P;
+  };
+  // From a result or outcome, if our error and exception types are constructible
+  template <class R, class S, class P, class N, class T>
+  struct accepts_failure_forwarder<outcome<R, S, P, N>, T>
+      : std::integral_constant<bool, (is_result<T>::value || is_outcome<T>::value)                  //
+                                     && is_explicitly_constructible<S, typename T::error_type>  //
+                                     && (std::is_void<typename forwarded_exception_type<T>::type>::value || is_explicitly_constructible<P, typename forwarded_exception_type<T>::type>)>
   {
   };
 }  // namespace detail
@@ -130,7 +170,7 @@ namespace detail
 //! True if an outcome
 template <class T> using is_outcome = detail::is_outcome<std::decay_t<T>>;
 //! True if an outcome
-template <class T> static constexpr bool is_outcome_v = detail::is_outcome<std::decay_t<T>>::value;
+template <class T> constexpr bool is_outcome_v = detail::is_outcome<std::decay_t<T>>::value;
 
 namespace hooks
 {
@@ -153,7 +193,8 @@ namespace hooks
   /*! The default instantiation hook implementation called when a `outcome` is created by moving
   from another `outcome` or `result`. Does nothing.
   \param 1 Some `outcome<...>` being constructed.
-  \param 2 The source data.
+  \param 2 The source data. When `OUTCOME_TRY` propagates the failure of a `result` or another `outcome`,
+  this is a reference to that failed `result` or `outcome`, not a `failure_type`, whether or not it is an rvalue.
 
   WARNING: The compiler is permitted to elide calls to constructors, and thus this hook may not get called when you think it should!
   */
@@ -174,7 +215,7 @@ namespace hooks
 
 /*! Used to return from functions one of (i) a successful value (ii) a cause of failure (ii) a different cause of failure. `constexpr` capable.
 
-\tparam R The optional type of the successful result (use `void` to disable). Cannot be a reference, a `in_place_type_t<>`, `success<>`, `failure<>`, an array, a function or non-destructible.
+\tparam R The optional type of the successful result (use `void` to disable). Can be an lvalue reference, which is stored as a pointer and rebinds on assignment. Cannot be an rvalue reference, a `in_place_type_t<>`, `success<>`, `failure<>`, an array, a function or non-destructible.
 \tparam S The optional type of the first failure result (use `void` to disable). Must be either `void` or `DefaultConstructible`. Cannot be a reference, a `in_place_type_t<>`, `success<>`, `failure<>`, an array, a function or non-destructible.
 \tparam P The optional type of the second failure result (use `void` to disable). Must be either `void` or `DefaultConstructible`. Cannot be a reference, a `in_place_type_t<>`, `success<>`, `failure<>`, an array, a function or non-destructible.
 \tparam NoValuePolicy Policy on how to interpret types `S` and `P` when a wide observation of a not present value occurs.
@@ -211,8 +252,7 @@ or if `P` is `void`, do `throw bad_outcome_access()`
 or if `S` is `void`, do `throw bad_outcome_access()`
    - If `S` is none of the above, then it is undefined behaviour [`policy::all_narrow`]
 */
-template <class R, class S, class P, class NoValuePolicy>                                                                       //
-OUTCOME_REQUIRES(detail::type_can_be_used_in_result<P> && (std::is_void<P>::value || std::is_default_constructible<P>::value))  //
+template <class R, class S, class P, class NoValuePolicy>
 class OUTCOME_NODISCARD outcome
 #if defined(DOXYGEN_IS_IN_THE_HOUSE) || defined(STANDARDESE_IS_IN_THE_HOUSE)
 : public detail::outcome_failure_observers<detail::select_outcome_impl2<R, S, P, NoValuePolicy>, R, S, P, NoValuePolicy>,
@@ -274,6 +314,19 @@ protected:
   {
     using base = detail::outcome_predicates<value_type, error_type, exception_type>;
 
+#if OUTCOME_USE_CXX20_CONCEPTS
+    //! Predicate for the value converting constructor to be available.
+    template <class T> static constexpr bool enable_value_converting_constructor = detail::outcome_value_converting_constructible<T, outcome, value_type, error_type, exception_type>;
+
+    //! Predicate for the error converting constructor to be available.
+    template <class T> static constexpr bool enable_error_converting_constructor = detail::outcome_error_converting_constructible<T, outcome, value_type, error_type, exception_type>;
+
+    //! Predicate for the error condition converting constructor to be available.
+    template <class ErrorCondEnum> static constexpr bool enable_error_condition_converting_constructor = detail::outcome_error_condition_converting_constructible<ErrorCondEnum, outcome, value_type, error_type, exception_type>;
+
+    // Predicate for the exception converting constructor to be available.
+    template <class T> static constexpr bool enable_exception_converting_constructor = detail::outcome_exception_converting_constructible<T, outcome, value_type, error_type, exception_type>;
+#else
     //! Predicate for the value converting constructor to be available.
     template <class T>
     static constexpr bool enable_value_converting_constructor =  //
@@ -297,6 +350,11 @@ protected:
     static constexpr bool enable_exception_converting_constructor =  //
     !std::is_same<std::decay_t<T>, outcome>::value                   // not my type
     && base::template enable_exception_converting_constructor<T>;
+#endif
+
+    //! Predicate for the failure forwarding constructor from a failed compatible result or outcome to be available.
+    template <class T>
+    static constexpr bool enable_failure_forwarding = detail::accepts_failure_forwarder<outcome, T>::value;
 
     //! Predicate for the converting constructor from a compatible input to be available.
     template <class T, class U, class V, class W>
@@ -308,7 +366,7 @@ protected:
     template <class... Args>
     static constexpr bool enable_inplace_value_constructor =  //
     std::is_void<value_type>::value                           //
-    || std::is_constructible<value_type, Args...>::value;
+    || std::is_constructible<detail::value_storage_type<value_type>, Args...>::value;
 
     //! Predicate for the inplace construction of error to be available.
     template <class... Args>
@@ -766,6 +824,33 @@ public:
     hook_outcome_move_construction(this, std::move(o));
   }
 
+private:
+  template <class T> using _forwards_exception = std::integral_constant<bool, !std::is_void<typename detail::forwarded_exception_type<std::decay_t<T>>::type>::value>;
+  template <class T> static constexpr exception_type _forwarded_exception(const T & /*unused*/, std::false_type /*unused*/) noexcept(std::is_nothrow_default_constructible<exception_type>::value) { return exception_type(); }
+  template <class T> static constexpr decltype(auto) _forwarded_exception(T &&o, std::true_type /*unused*/) noexcept { return (std::forward<T>(o)._ptr); }
+
+public:
+  /*! Implicit failure forwarding constructor, used by `OUTCOME_TRY` to propagate the failure of a result or another outcome.
+  \tparam 1
+  \exclude
+  \param o A reference to a failed compatible result or outcome.
+
+  \effects Initialises the outcome with a copy or move of the error and exception of the source, directly from
+  its storage rather than via an intermediate `failure_type`. Unlike construction from a `failure_type`, which
+  of error and exception are present is taken from the source rather than by comparing them to default constructed.
+  \requires Our `error_type` and `exception_type` to be constructible from the source's, or the source to be a `result`.
+  \throws Any exception the construction of `error_type` or `exception_type` might throw.
+  */
+  OUTCOME_TEMPLATE(class T)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(predicate::template enable_failure_forwarding<std::decay_t<T>>))
+  constexpr outcome(detail::failure_forwarder<T> &&o) noexcept(std::is_nothrow_constructible<error_type, decltype(std::declval<T &&>().assume_error())>::value &&std::is_nothrow_constructible<exception_type, decltype(_forwarded_exception(std::declval<T &&>(), _forwards_exception<T>()))>::value)  // NOLINT
+  : base{typename base::failure_forwarding_tag(), o.source()},
+    _ptr(_forwarded_exception(o.source(), _forwards_exception<T>()))
+  {
+    using namespace hooks;
+    hook_outcome_move_construction(this, o.source());
+  }
+
   /// \output_section Comparison operators
   using base::operator==;
   using base::operator!=;
@@ -879,6 +964,94 @@ public:
     return false;
   }
 
+  /// \output_section Emplacement
+  /*! Replaces any value, error or exception with a `value_type` constructed in place, without constructing a temporary outcome.
+  \tparam 1
+  \exclude
+  \returns A reference to the newly constructed `value_type`.
+  \param args Arguments with which to in place construct. These must not refer to the state being replaced.
+
+  \effects Resets any `error_type` and `exception_type` to default construction, destroys any `value_type`, and in place
+  constructs `value_type` from `args...`. Spare storage is preserved.
+  \requires `value_type` is void or `Args...` are constructible to `value_type`.
+  \throws Any exception the reset of `error_type` or `exception_type` might throw, in which case the outcome is unchanged
+  other than those possibly being modified, or any exception the construction of `value_type(Args...)` might throw, in which
+  case any previous `value_type` has been destroyed, and any previous `error_type` and `exception_type` remain reset to
+  default construction.
+  */
+  OUTCOME_TEMPLATE(class... Args)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(predicate::template enable_inplace_value_constructor<Args...>))
+  std::add_lvalue_reference_t<value_type> emplace_value(Args &&... args) noexcept(noexcept(std::declval<decltype(base::_state) &>().emplace(std::declval<Args>()...)) &&noexcept(detail::emplace_member(std::declval<decltype(base::_error) &>())) &&noexcept(detail::emplace_member(std::declval<decltype(_ptr) &>())))
+  {
+    // Reset the error and exception before constructing the value, so an exception throw never leaves both present
+    if((this->_state._status & detail::status_have_error) != 0)
+    {
+      detail::emplace_member(this->_error);
+    }
+    if((this->_state._status & detail::status_have_exception) != 0)
+    {
+      detail::emplace_member(this->_ptr);
+    }
+    this->_state.emplace(std::forward<Args>(args)...);
+    this->_state._status = (this->_state._status & detail::status_2byte_mask) | detail::status_have_value;
+    using namespace hooks;
+    hook_outcome_in_place_construction(this, in_place_type<value_type>, std::forward<Args>(args)...);
+    return static_cast<std::add_lvalue_reference_t<value_type>>(this->_state._value);
+  }
+  /*! Replaces any value, error or exception with an `error_type` constructed in place, without constructing a temporary outcome.
+  \tparam 1
+  \exclude
+  \returns A reference to the newly constructed `error_type`.
+  \param args Arguments with which to in place construct. These must not refer to the state being replaced.
+
+  \effects Destroys any `value_type`, resets any `exception_type` to default construction, and constructs `error_type`
+  from `args...` in place if that cannot throw, else assigns it from a temporary. Spare storage is preserved.
+  \requires `error_type` is void or `Args...` are constructible to `error_type`.
+  \throws Any exception the construction of `error_type(Args...)` might throw, in which case any previous `value_type` has been destroyed.
+  */
+  OUTCOME_TEMPLATE(class... Args)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(predicate::template enable_inplace_error_constructor<Args...>))
+  std::add_lvalue_reference_t<error_type> emplace_error(Args &&... args) noexcept(noexcept(std::declval<decltype(base::_state) &>().reset()) &&noexcept(detail::emplace_member(std::declval<decltype(base::_error) &>(), std::declval<Args>()...)) &&noexcept(detail::emplace_member(std::declval<decltype(_ptr) &>())))
+  {
+    this->_state.reset();
+    detail::emplace_member(this->_error, std::forward<Args>(args)...);
+    if((this->_state._status & detail::status_have_exception) != 0)
+    {
+      detail::emplace_member(this->_ptr);
+    }
+    this->_state._status = (this->_state._status & detail::status_2byte_mask) | detail::status_have_error;
+    detail::_set_error_is_errno(this->_state, this->_error);
+    using namespace hooks;
+    hook_outcome_in_place_construction(this, in_place_type<error_type>, std::forward<Args>(args)...);
+    return static_cast<std::add_lvalue_reference_t<error_type>>(this->_error);
+  }
+  /*! Replaces any value, error or exception with an `exception_type` constructed in place, without constructing a temporary outcome.
+  \tparam 1
+  \exclude
+  \returns A reference to the newly constructed `exception_type`.
+  \param args Arguments with which to in place construct. These must not refer to the state being replaced.
+
+  \effects Destroys any `value_type`, resets any `error_type` to default construction, and constructs `exception_type`
+  from `args...` in place if that cannot throw, else assigns it from a temporary. Spare storage is preserved.
+  \requires `exception_type` is void or `Args...` are constructible to `exception_type`.
+  \throws Any exception the construction of `exception_type(Args...)` might throw, in which case any previous `value_type` has been destroyed.
+  */
+  OUTCOME_TEMPLATE(class... Args)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(predicate::template enable_inplace_exception_constructor<Args...>))
+  std::add_lvalue_reference_t<exception_type> emplace_exception(Args &&... args) noexcept(noexcept(std::declval<decltype(base::_state) &>().reset()) &&noexcept(detail::emplace_member(std::declval<decltype(base::_error) &>())) &&noexcept(detail::emplace_member(std::declval<decltype(_ptr) &>(), std::declval<Args>()...)))
+  {
+    this->_state.reset();
+    if((this->_state._status & detail::status_have_error) != 0)
+    {
+      detail::emplace_member(this->_error);
+    }
+    detail::emplace_member(this->_ptr, std::forward<Args>(args)...);
+    this->_state._status = (this->_state._status & detail::status_2byte_mask) | detail::status_have_exception;
+    using namespace hooks;
+    hook_outcome_in_place_construction(this, in_place_type<exception_type>, std::forward<Args>(args)...);
+    return static_cast<std::add_lvalue_reference_t<exception_type>>(this->_ptr);
+  }
+
   /// \output_section Swap
   /*! Swaps this result with another result
   \effects Any `R` and/or `S` is swapped along with the metadata tracking them.
@@ -917,7 +1090,7 @@ public:
 #pragma warning(pop)
 #endif
 #else
-    swap(this->_state, o._state);
+    this->_state.swap(o._state);
     swap(this->_error, o._error);
     swap(this->_ptr, o._ptr);
 #endif
@@ -957,6 +1130,7 @@ public:
   }
 };
 
+#ifndef __cpp_impl_three_way_comparison  // C++ 20 rewrites `a == b` into `b == a`, which this would then recurse into
 /*! True if the result is equal to the outcome
 \tparam 7
 \exclude
@@ -975,6 +1149,7 @@ noexcept(std::declval<outcome<R, S, P, N>>() == std::declval<result<T, U, V>>())
 {
   return b == a;
 }
+#endif
 /*! True if the result is not equal to the outcome
 \tparam 7
 \exclude
@@ -1001,6 +1176,14 @@ template <class R, class S, class P, class N> inline void swap(outcome<R, S, P,
   a.swap(b);
 }
 
+namespace trait
+{
+  //! `outcome<R, S, P>` is trivially relocatable if all of `R`, `S` and `P` are.
+  template <class R, class S, class P, class N> struct is_trivially_relocatable<outcome<R, S, P, N>> : std::integral_constant<bool, is_trivially_relocatable<OUTCOME_V2_NAMESPACE::detail::result_storage<R, S, N>>::value && is_trivially_relocatable<P>::value>
+  {
+  };
+}  // namespace trait
+
 namespace hooks
 {
   /*! Used to set/override an exception during a construction hook implementation.
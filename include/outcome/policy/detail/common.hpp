@@ -57,7 +57,7 @@ namespace policy
       /*! Performs a narrow check of state, used in the assume_value() functions.
       \effects None.
       */
-      template <class Impl> static constexpr void narrow_value_check(Impl &&self) noexcept
+      template <class Impl> OUTCOME_FORCEINLINE static constexpr void narrow_value_check(Impl &&self) noexcept
       {
         if((self._state._status & OUTCOME_V2_NAMESPACE::detail::status_have_value) == 0)
         {
@@ -67,7 +67,7 @@ namespace policy
       /*! Performs a narrow check of state, used in the assume_error() functions
       \effects None.
       */
-      template <class Impl> static constexpr void narrow_error_check(Impl &&self) noexcept
+      template <class Impl> OUTCOME_FORCEINLINE static constexpr void narrow_error_check(Impl &&self) noexcept
       {
         if((self._state._status & OUTCOME_V2_NAMESPACE::detail::status_have_error) == 0)
         {
@@ -77,7 +77,7 @@ namespace policy
       /*! Performs a narrow check of state, used in the assume_exception() functions
       \effects None.
       */
-      template <class Impl> static constexpr void narrow_exception_check(Impl &&self) noexcept
+      template <class Impl> OUTCOME_FORCEINLINE static constexpr void narrow_exception_check(Impl &&self) noexcept
       {
         if((self._state._status & OUTCOME_V2_NAMESPACE::detail::status_have_exception) == 0)
         {
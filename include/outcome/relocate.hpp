@@ -0,0 +1,105 @@
+/* Relocation of arrays of objects
+(C) 2026 agent <agent@local> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_RELOCATE_HPP
+#define OUTCOME_RELOCATE_HPP
+
+#include "outcome.hpp"
+
+#include <cstring>  // for memmove
+#include <new>
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdocumentation"  // Standardese markup confuses clang
+#endif
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+namespace detail
+{
+  template <class T> inline T *relocate(T *first, T *last, T *dest, std::true_type /*trivially relocatable*/) noexcept
+  {
+    const size_t count = static_cast<size_t>(last - first);
+    memmove(static_cast<void *>(dest), static_cast<const void *>(first), count * sizeof(T));
+    return dest + count;
+  }
+  template <class T> inline T *relocate(T *first, T *last, T *dest, std::false_type /*trivially relocatable*/)
+  {
+    // Construct all the new objects before destroying any of the old, so if a copy throws the source is left
+    // untouched. A throwing move of a move only T leaves the sources already moved from in their moved from state.
+    T *out = dest;
+#ifdef __cpp_exceptions
+    try
+    {
+#endif
+      for(T *in = first; in != last; ++in, ++out)
+      {
+        new(out) T(std::move_if_noexcept(*in));
+      }
+#ifdef __cpp_exceptions
+    }
+    catch(...)
+    {
+      for(T *i = dest; i != out; ++i)
+      {
+        i->~T();
+      }
+      throw;
+    }
+#endif
+    for(T *in = first; in != last; ++in)
+    {
+      in->~T();
+    }
+    return out;
+  }
+}  // namespace detail
+
+/*! Relocates a range of objects into uninitialised, non-overlapping storage, ending the lifetime of the originals.
+\returns One past the last object relocated into `dest`.
+\param first The first object to relocate.
+\param last One past the last object to relocate.
+\param dest Uninitialised storage for `last - first` objects of type `T`.
+
+\effects If `trait::is_trivially_relocatable<T>` is true, the objects are copied bitwise by `memmove()`.
+Otherwise each object is move constructed (or copy constructed, if its move constructor might throw and
+it is copyable) into `dest`, and once all have been constructed the originals are destroyed.
+\throws If not trivially relocatable, anything the construction of `T` might throw, in which case
+the objects constructed so far in `dest` are destroyed and the originals are not destroyed. If `T` was copy
+constructed the originals are left untouched, but if `T` is move only with a throwing move constructor, the
+originals already moved from are left in their moved from state.
+*/
+template <class T> inline T *relocate(T *first, T *last, T *dest) noexcept(trait::is_trivially_relocatable<T>::value || std::is_nothrow_move_constructible<T>::value)
+{
+  return detail::relocate(first, last, dest, std::integral_constant<bool, trait::is_trivially_relocatable<T>::value>());
+}
+
+OUTCOME_V2_NAMESPACE_END
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+
+#endif
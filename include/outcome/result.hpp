@@ -58,14 +58,40 @@ namespace policy
   >>>;
 }  // namespace policy
 
-template <class R, class S = std::error_code, class NoValuePolicy = policy::default_policy<R, S, void>>                                                                 //
-#if !defined(__GNUC__) || __GNUC__ >= 8                                                                                                                                 // GCC's constraints implementation is buggy
-OUTCOME_REQUIRES(detail::type_can_be_used_in_result<R> &&detail::type_can_be_used_in_result<S> && (std::is_void<S>::value || std::is_default_constructible<S>::value))  //
-#endif
+template <class R, class S = std::error_code, class NoValuePolicy = policy::default_policy<R, S, void>>
 class result;
 
 namespace detail
 {
+#if OUTCOME_USE_CXX20_CONCEPTS
+  template <class value_type, class error_type> struct result_predicates;
+
+  /* A conjunction of atomic constraints stops at the first which is not satisfied, and each
+  satisfaction is cached by the compiler, whereas the predicate variables below instantiate
+  every trait they name. The converting constructor predicates, which are evaluated for every
+  conversion into a result, are therefore expressed as concepts when possible.
+  */
+  template <class T, class Self, class value_type, class error_type>
+  concept result_value_converting_constructible =                                                     //
+  !std::is_same<std::decay_t<T>, Self>::value                                                         // not my type
+  && result_predicates<value_type, error_type>::implicit_constructors_enabled                         //
+  && !is_in_place_type_t<std::decay_t<T>>::value                                                      // not in place construction
+  && detail::is_implicitly_constructible<value_storage_type<value_type>, T>                           // never binds a reference value to a temporary
+  && !detail::is_implicitly_constructible<error_type, T>;
+  template <class T, class Self, class value_type, class error_type>
+  concept result_error_converting_constructible =                                                     //
+  !std::is_same<std::decay_t<T>, Self>::value                                                         // not my type
+  && result_predicates<value_type, error_type>::implicit_constructors_enabled                         //
+  && !is_in_place_type_t<std::decay_t<T>>::value                                                      // not in place construction
+  && !detail::is_implicitly_constructible<value_type, T> && detail::is_implicitly_constructible<error_type, T>;
+  template <class ErrorCondEnum, class Self, class value_type, class error_type>
+  concept result_error_condition_converting_constructible =                                                                               //
+  !std::is_same<std::decay_t<ErrorCondEnum>, Self>::value                                                                                 // not my type
+  && !is_in_place_type_t<std::decay_t<ErrorCondEnum>>::value                                                                              // not in place construction
+  && std::is_error_condition_enum<ErrorCondEnum>::value                                                                                   // is an error condition enum
+  && !detail::is_implicitly_constructible<value_type, ErrorCondEnum> && !detail::is_implicitly_constructible<error_type, ErrorCondEnum>;  // not constructible via any other means
+#endif
+
   // These are reused by outcome to save load on the compiler
   template <class value_type, class error_type> struct result_predicates
   {
@@ -83,7 +109,8 @@ namespace detail
     static constexpr bool enable_value_converting_constructor =  //
     implicit_constructors_enabled                                //
     && !is_in_place_type_t<std::decay_t<T>>::value               // not in place construction
-    && detail::is_implicitly_constructible<value_type, T> && !detail::is_implicitly_constructible<error_type, T>;
+    && detail::is_implicitly_constructible<value_storage_type<value_type>, T>  // never binds a reference value to a temporary
+    && !detail::is_implicitly_constructible<error_type, T>;
 
     // Predicate for the error converting constructor to be available.
     template <class T>
@@ -102,7 +129,7 @@ namespace detail
     // Predicate for the converting copy constructor from a compatible input to be available.
     template <class T, class U, class V>
     static constexpr bool enable_compatible_conversion =                                                                 //
-    (std::is_void<T>::value || detail::is_explicitly_constructible<value_type, typename result<T, U, V>::value_type>)    // if our value types are constructible
+    (std::is_void<T>::value || detail::is_explicitly_constructible<value_storage_type<value_type>, value_storage_type<typename result<T, U, V>::value_type>>)  // if our value types are constructible
     &&(std::is_void<U>::value || detail::is_explicitly_constructible<error_type, typename result<T, U, V>::error_type>)  // if our error types are constructible
     ;
 
@@ -132,10 +159,11 @@ namespace detail
   template <class T, class U, class V> constexpr inline U &&extract_error_from_failure(failure_type<U, V> &&v) { return std::move(v).error(); }
   template <class T, class V> constexpr inline T extract_error_from_failure(const failure_type<void, V> & /*unused*/) { return T{}; }
 
-  template <class T> struct is_result : std::false_type
+  template <class R, class S, class T> struct is_result<result<R, S, T>> : std::true_type
   {
   };
-  template <class R, class S, class T> struct is_result<result<R, S, T>> : std::true_type
+  // From a result, if our error types are constructible
+  template <class R, class S, class P, class T> struct accepts_failure_forwarder<result<R, S, P>, T> : std::integral_constant<bool, is_result<T>::value && is_explicitly_constructible<S, typename T::error_type>>
   {
   };
 }  // namespace detail
@@ -143,7 +171,7 @@ namespace detail
 //! True if a result
 template <class T> using is_result = detail::is_result<std::decay_t<T>>;
 //! True if a result
-template <class T> static constexpr bool is_result_v = detail::is_result<std::decay_t<T>>::value;
+template <class T> constexpr bool is_result_v = detail::is_result<std::decay_t<T>>::value;
 
 //! Namespace for ADL discovered hooks into events in `result` and `outcome`.
 namespace hooks
@@ -167,7 +195,8 @@ namespace hooks
   /*! The default instantiation hook implementation called when a `result` is created by moving
   from another `result`. Does nothing.
   \param 1 Some `result<...>` being constructed.
-  \param 2 The source data.
+  \param 2 The source data. When `OUTCOME_TRY` propagates the failure of another `result`, this is
+  a reference to that failed `result`, not a `failure_type`, whether or not that `result` is an rvalue.
 
   WARNING: The compiler is permitted to elide calls to constructors, and thus this hook may not get called when you think it should!
   */
@@ -185,12 +214,12 @@ namespace hooks
   //! Retrieves the 16 bits of spare storage in result/outcome.
   template <class R, class S, class NoValuePolicy> constexpr inline uint16_t spare_storage(const detail::result_final<R, S, NoValuePolicy> *r) noexcept { return (r->_state._status >> detail::status_2byte_shift) & 0xffff; }
   //! Sets the 16 bits of spare storage in result/outcome.
-  template <class R, class S, class NoValuePolicy> constexpr inline void set_spare_storage(detail::result_final<R, S, NoValuePolicy> *r, uint16_t v) noexcept { r->_state._status |= (v << detail::status_2byte_shift); }
+  template <class R, class S, class NoValuePolicy> constexpr inline void set_spare_storage(detail::result_final<R, S, NoValuePolicy> *r, uint16_t v) noexcept { r->_state._status = (r->_state._status & ~detail::status_2byte_mask) | (static_cast<detail::status_bitfield_type>(v) << detail::status_2byte_shift); }
 }  // namespace hooks
 
 /*! Used to return from functions either (i) a successful value (ii) a cause of failure. `constexpr` capable.
 
-\tparam R The optional type of the successful result (use `void` to disable). Cannot be a reference, a `in_place_type_t<>`, `success<>`, `failure<>`, an array, a function or non-destructible.
+\tparam R The optional type of the successful result (use `void` to disable). Can be an lvalue reference, which is stored as a pointer and rebinds on assignment. Cannot be an rvalue reference, a `in_place_type_t<>`, `success<>`, `failure<>`, an array, a function or non-destructible.
 \tparam S The optional type of the failure result (use `void` to disable). Must be either `void` or `DefaultConstructible`. Cannot be a reference, a `in_place_type_t<>`, `success<>`, `failure<>`, an array, a function or non-destructible.
 \tparam NoValuePolicy Policy on how to interpret type `S` when a wide observation of a not present value occurs.
 
@@ -211,13 +240,10 @@ then `throw std::system_error(error()|make_error_code(error()))` [\verbatim {{<a
 or if `S` is `void`, do `throw bad_result_access()`
    - If `S` is none of the above, then it is undefined behaviour [`policy::all_narrow`]
 */
-template <class R, class S, class NoValuePolicy>                                                                                                                        //
-#if !defined(__GNUC__) || __GNUC__ >= 8                                                                                                                                 // GCC's constraints implementation is buggy
-OUTCOME_REQUIRES(detail::type_can_be_used_in_result<R> &&detail::type_can_be_used_in_result<S> && (std::is_void<S>::value || std::is_default_constructible<S>::value))  //
-#endif
+template <class R, class S, class NoValuePolicy>
 class OUTCOME_NODISCARD result : public detail::result_final<R, S, NoValuePolicy>
 {
-  static_assert(detail::type_can_be_used_in_result<R>, "The type R cannot be used in a result");
+  static_assert(detail::type_can_be_used_as_value_in_result<R>, "The type R cannot be used in a result");
   static_assert(detail::type_can_be_used_in_result<S>, "The type S cannot be used in a result");
   static_assert(std::is_void<S>::value || std::is_default_constructible<S>::value, "The type S must be void or default constructible");
 
@@ -260,6 +286,16 @@ protected:
   {
     using base = detail::result_predicates<value_type, error_type>;
 
+#if OUTCOME_USE_CXX20_CONCEPTS
+    //! Predicate for the value converting constructor to be available.
+    template <class T> static constexpr bool enable_value_converting_constructor = detail::result_value_converting_constructible<T, result, value_type, error_type>;
+
+    //! Predicate for the error converting constructor to be available.
+    template <class T> static constexpr bool enable_error_converting_constructor = detail::result_error_converting_constructible<T, result, value_type, error_type>;
+
+    //! Predicate for the error condition converting constructor to be available.
+    template <class ErrorCondEnum> static constexpr bool enable_error_condition_converting_constructor = detail::result_error_condition_converting_constructible<ErrorCondEnum, result, value_type, error_type>;
+#else
     //! Predicate for the value converting constructor to be available.
     template <class T>
     static constexpr bool enable_value_converting_constructor =  //
@@ -277,6 +313,7 @@ protected:
     static constexpr bool enable_error_condition_converting_constructor =  //
     !std::is_same<std::decay_t<ErrorCondEnum>, result>::value              // not my type
     && base::template enable_error_condition_converting_constructor<ErrorCondEnum>;
+#endif
 
     //! Predicate for the converting copy constructor from a compatible input to be available.
     template <class T, class U, class V>
@@ -284,11 +321,15 @@ protected:
     !std::is_same<result<T, U, V>, result>::value         // not my type
     && base::template enable_compatible_conversion<T, U, V>;
 
+    //! Predicate for the failure forwarding constructor from a failed compatible result to be available.
+    template <class T>
+    static constexpr bool enable_failure_forwarding = detail::accepts_failure_forwarder<result, T>::value;
+
     //! Predicate for the inplace construction of value to be available.
     template <class... Args>
     static constexpr bool enable_inplace_value_constructor =  //
     std::is_void<value_type>::value                           //
-    || std::is_constructible<value_type, Args...>::value;
+    || std::is_constructible<detail::value_storage_type<value_type>, Args...>::value;
 
     //! Predicate for the inplace construction of error to be available.
     template <class... Args>
@@ -617,6 +658,77 @@ public:
     using namespace hooks;
     hook_result_move_construction(this, std::move(o));
   }
+  /*! Implicit failure forwarding constructor, used by `OUTCOME_TRY` to propagate the failure of another result.
+  \tparam 1
+  \exclude
+  \param o A reference to a failed compatible result.
+
+  \effects Initialises the result with a copy or move of the error of the source result, directly from
+  its storage rather than via an intermediate `failure_type`.
+  \requires Our `error_type` to be constructible from the source's `error_type`.
+  \throws Any exception the construction of `error_type` might throw.
+  */
+  OUTCOME_TEMPLATE(class T)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(predicate::template enable_failure_forwarding<std::decay_t<T>>))
+  constexpr result(detail::failure_forwarder<T> &&o) noexcept(std::is_nothrow_constructible<error_type, decltype(std::declval<T &&>().assume_error())>::value)  // NOLINT
+  : base{typename base::failure_forwarding_tag(), o.source()}
+  {
+    using namespace hooks;
+    hook_result_move_construction(this, o.source());
+  }
+
+  /// \output_section Emplacement
+  /*! Replaces any value or error with a `value_type` constructed in place, without constructing a temporary result.
+  \tparam 1
+  \exclude
+  \returns A reference to the newly constructed `value_type`.
+  \param args Arguments with which to in place construct. These must not refer to the state being replaced.
+
+  \effects Resets any `error_type` to default construction, destroys any `value_type`, and in place constructs
+  `value_type` from `args...`. Spare storage is preserved.
+  \requires `value_type` is void or `Args...` are constructible to `value_type`.
+  \throws Any exception the reset of `error_type` might throw, in which case the result is unchanged other than the
+  `error_type` possibly being modified, or any exception the construction of `value_type(Args...)` might throw, in which
+  case any previous `value_type` has been destroyed, and any previous `error_type` remains reset to default construction.
+  */
+  OUTCOME_TEMPLATE(class... Args)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(predicate::template enable_inplace_value_constructor<Args...>))
+  std::add_lvalue_reference_t<value_type> emplace_value(Args &&... args) noexcept(noexcept(std::declval<decltype(base::_state) &>().emplace(std::declval<Args>()...)) &&noexcept(detail::emplace_member(std::declval<decltype(base::_error) &>())))
+  {
+    // Reset the error before constructing the value, so an exception throw from either never leaves both present
+    if((this->_state._status & detail::status_have_error) != 0)
+    {
+      detail::emplace_member(this->_error);
+    }
+    this->_state.emplace(std::forward<Args>(args)...);
+    this->_state._status = (this->_state._status & detail::status_2byte_mask) | detail::status_have_value;
+    using namespace hooks;
+    hook_result_in_place_construction(this, in_place_type<value_type>, std::forward<Args>(args)...);
+    return static_cast<std::add_lvalue_reference_t<value_type>>(this->_state._value);
+  }
+  /*! Replaces any value or error with an `error_type` constructed in place, without constructing a temporary result.
+  \tparam 1
+  \exclude
+  \returns A reference to the newly constructed `error_type`.
+  \param args Arguments with which to in place construct. These must not refer to the state being replaced.
+
+  \effects Destroys any `value_type`, and constructs `error_type` from `args...` in place if that cannot throw,
+  else assigns it from a temporary. Spare storage is preserved.
+  \requires `error_type` is void or `Args...` are constructible to `error_type`.
+  \throws Any exception the construction of `error_type(Args...)` might throw, in which case any previous `value_type` has been destroyed.
+  */
+  OUTCOME_TEMPLATE(class... Args)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(predicate::template enable_inplace_error_constructor<Args...>))
+  std::add_lvalue_reference_t<error_type> emplace_error(Args &&... args) noexcept(noexcept(std::declval<decltype(base::_state) &>().reset()) &&noexcept(detail::emplace_member(std::declval<decltype(base::_error) &>(), std::declval<Args>()...)))
+  {
+    this->_state.reset();
+    detail::emplace_member(this->_error, std::forward<Args>(args)...);
+    this->_state._status = (this->_state._status & detail::status_2byte_mask) | detail::status_have_error;
+    detail::_set_error_is_errno(this->_state, this->_error);
+    using namespace hooks;
+    hook_result_in_place_construction(this, in_place_type<error_type>, std::forward<Args>(args)...);
+    return static_cast<std::add_lvalue_reference_t<error_type>>(this->_error);
+  }
 
   /// \output_section Swap
   /*! Swaps this result with another result
@@ -630,6 +742,9 @@ public:
 #ifdef _MSC_VER
 #pragma warning(push)
 #pragma warning(disable : 4297)  // use of throw in noexcept function
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wterminate"  // use of throw in noexcept function
 #endif
     this->_state.swap(o._state);
     try
@@ -643,9 +758,11 @@ public:
     }
 #ifdef _MSC_VER
 #pragma warning(pop)
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
 #endif
 #else
-    swap(this->_state, o._state);
+    this->_state.swap(o._state);
     swap(this->_error, o._error);
 #endif
   }
@@ -669,6 +786,14 @@ template <class R, class S, class P> inline void swap(result<R, S, P> &a, result
   a.swap(b);
 }
 
+namespace trait
+{
+  //! `result<R, S>` is trivially relocatable if both `R` and `S` are.
+  template <class R, class S, class P> struct is_trivially_relocatable<result<R, S, P>> : is_trivially_relocatable<OUTCOME_V2_NAMESPACE::detail::result_storage<R, S, P>>
+  {
+  };
+}  // namespace trait
+
 #if !defined(NDEBUG)
 // Check is trivial in all ways except default constructibility
 // static_assert(std::is_trivial<result<int>>::value, "result<int> is not trivial!");
@@ -0,0 +1,370 @@
+/* Bounded lock free queues of results storing values, statuses and errors separately
+(C) 2026 agent <agent@local> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_RESULT_QUEUE_HPP
+#define OUTCOME_RESULT_QUEUE_HPP
+
+#include "result.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdocumentation"  // Standardese markup confuses clang
+#endif
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+namespace detail
+{
+  // Number of trailing zero bits, x must not be zero
+  inline unsigned count_trailing_zeros(uint64_t x) noexcept
+  {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_ctzll(x));
+#elif defined(_MSC_VER) && defined(_M_X64)
+    unsigned long ret;
+    _BitScanForward64(&ret, x);
+    return static_cast<unsigned>(ret);
+#else
+    unsigned ret = 0;
+    for(; (x & 1) == 0; x >>= 1)
+    {
+      ++ret;
+    }
+    return ret;
+#endif
+  }
+
+  /* Counts the bits equal to `want` in a ring of `Bits` bits starting from `idx`, stopping at the
+  first which is not, or at `limit`. Each word is loaded once, so runs are counted 64 bits at a time.
+  */
+  template <size_t Bits> inline size_t count_bit_run(const std::atomic<uint64_t> *words, size_t idx, size_t limit, bool want, std::memory_order order) noexcept
+  {
+    size_t n = 0;
+    while(n < limit)
+    {
+      const size_t pos = (idx + n) & (Bits - 1), b = pos % 64;
+      uint64_t bits = words[pos / 64].load(order) >> b;
+      // Make wanted bits ones, and the bits shifted in from above the word zeros
+      if(!want)
+      {
+        bits = ~bits & (~uint64_t(0) >> b);
+      }
+      const size_t avail = 64 - b, run = (~bits == 0) ? 64 : count_trailing_zeros(~bits);
+      if(run < avail)
+      {
+        n += run;
+        break;
+      }
+      n += avail;
+    }
+    return n < limit ? n : limit;
+  }
+}  // namespace detail
+
+/*! A bounded lock free queue of `result<R, S, NoValuePolicy>`, which does not store results as such.
+
+Values live in a contiguous ring of `Capacity` `R`, whether each slot holds a value or an error is one
+bit in a separate packed bitmap, and errors live in a side ring of `ErrorCapacity` `S`, as errors are
+assumed to be rare. A consumer can therefore find a run of successes by scanning the bitmap 64 slots at a
+time, and drain or skip that run without looking at any status or error.
+
+Pushing fails if the value ring is full, or if pushing an error and the error ring is full. Exactly one
+thread may consume. If `MultipleProducers` is false, exactly one thread may produce, else any number may.
+Producers claim slot and error ring positions together with a single compare and swap, and mark slots
+ready in a second bitmap.
+
+\tparam R The `value_type`, which must be nothrow move constructible.
+\tparam S The `error_type`, which must be nothrow move assignable.
+\tparam Capacity The number of slots, a power of two of at least 64.
+\tparam ErrorCapacity The number of errors which may be queued at once, a power of two.
+\tparam MultipleProducers Whether any number of threads may push concurrently.
+\tparam NoValuePolicy The no value policy of `result_type`.
+*/
+template <class R, class S, size_t Capacity, size_t ErrorCapacity, bool MultipleProducers, class NoValuePolicy = policy::default_policy<R, S, void>> class basic_result_queue
+{
+  static_assert(Capacity >= 64 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two of at least 64");
+  static_assert(ErrorCapacity > 0 && (ErrorCapacity & (ErrorCapacity - 1)) == 0, "ErrorCapacity must be a power of two");
+  static_assert(std::is_nothrow_move_constructible<R>::value, "R must be nothrow move constructible");
+  static_assert(std::is_nothrow_move_assignable<S>::value, "S must be nothrow move assignable");
+
+public:
+  //! The type of result queued.
+  using result_type = result<R, S, NoValuePolicy>;
+  //! The success type.
+  using value_type = R;
+  //! The failure type.
+  using error_type = S;
+
+private:
+  static constexpr size_t _words = Capacity / 64;
+
+  // Both indices pack the slot index into the bottom 32 bits and the error ring index into the top 32 bits
+  static constexpr uint64_t _pack(uint32_t slot, uint32_t error) noexcept { return (static_cast<uint64_t>(error) << 32) | slot; }
+  static constexpr uint32_t _slot(uint64_t idx) noexcept { return static_cast<uint32_t>(idx); }
+  static constexpr uint32_t _error(uint64_t idx) noexcept { return static_cast<uint32_t>(idx >> 32); }
+
+  alignas(64) std::atomic<uint64_t> _tail{0};
+  alignas(64) std::atomic<uint64_t> _head{0};
+  alignas(64) std::atomic<uint64_t> _is_error[_words];
+  // Only used with multiple producers, as slots may be published out of order
+  std::atomic<uint64_t> _ready[MultipleProducers ? _words : 1];
+  std::aligned_storage_t<sizeof(R), alignof(R)> _values[Capacity];
+  S _errors[ErrorCapacity];
+
+  R *_value(size_t slot) noexcept { return reinterpret_cast<R *>(&_values[slot & (Capacity - 1)]); }  // NOLINT
+  static void _set_bit(std::atomic<uint64_t> *words, size_t slot, bool v, std::memory_order order) noexcept
+  {
+    slot &= Capacity - 1;
+    const uint64_t bit = uint64_t(1) << (slot % 64);
+    if(v)
+    {
+      words[slot / 64].fetch_or(bit, order);
+    }
+    else
+    {
+      words[slot / 64].fetch_and(~bit, order);
+    }
+  }
+  static void _clear_bits(std::atomic<uint64_t> *words, size_t slot, size_t count) noexcept
+  {
+    while(count > 0)
+    {
+      slot &= Capacity - 1;
+      const size_t b = slot % 64, n = (count < 64 - b) ? count : 64 - b;
+      const uint64_t mask = (n == 64) ? ~uint64_t(0) : (((uint64_t(1) << n) - 1) << b);
+      words[slot / 64].fetch_and(~mask, std::memory_order_relaxed);
+      slot += n;
+      count -= n;
+    }
+  }
+
+  template <class F> bool _push(bool is_error, F &&construct) noexcept
+  {
+    uint64_t tail = _tail.load(std::memory_order_relaxed), next;
+    for(;;)
+    {
+      const uint64_t head = _head.load(std::memory_order_acquire);
+      const uint32_t slots = _slot(tail) - _slot(head), errors = _error(tail) - _error(head);
+      if(slots > Capacity || errors > ErrorCapacity)
+      {
+        // With multiple producers tail may be older than head, if the consumer popped past it since
+        // it was loaded, in which case the differences underflow
+        tail = _tail.load(std::memory_order_relaxed);
+        continue;
+      }
+      if(slots == Capacity || (is_error && errors == ErrorCapacity))
+      {
+        if(MultipleProducers)
+        {
+          // Only full if no other producer has pushed since tail was loaded
+          const uint64_t now = _tail.load(std::memory_order_relaxed);
+          if(now != tail)
+          {
+            tail = now;
+            continue;
+          }
+        }
+        return false;
+      }
+      next = _pack(_slot(tail) + 1, _error(tail) + (is_error ? 1 : 0));
+      if(!MultipleProducers || _tail.compare_exchange_weak(tail, next, std::memory_order_relaxed, std::memory_order_relaxed))
+      {
+        break;
+      }
+    }
+    construct(_slot(tail), _error(tail));
+    _set_bit(_is_error, _slot(tail), is_error, std::memory_order_relaxed);
+    if(MultipleProducers)
+    {
+      _set_bit(_ready, _slot(tail), true, std::memory_order_release);
+    }
+    else
+    {
+      _tail.store(next, std::memory_order_release);
+    }
+    return true;
+  }
+  // Number of slots from head which are ready to consume, up to max
+  size_t _available(uint64_t head, size_t max) const noexcept
+  {
+    if(MultipleProducers)
+    {
+      return detail::count_bit_run<Capacity>(_ready, _slot(head), max < Capacity ? max : Capacity, true, std::memory_order_acquire);
+    }
+    const size_t available = _slot(_tail.load(std::memory_order_acquire)) - _slot(head);
+    return available < max ? available : max;
+  }
+  // Number of values at the front of the queue, up to max
+  size_t _value_run(uint64_t head, size_t max) const noexcept
+  {
+    return detail::count_bit_run<Capacity>(_is_error, _slot(head), _available(head, max), false, std::memory_order_relaxed);
+  }
+  void _release(uint64_t head, size_t slots, size_t errors) noexcept
+  {
+    if(MultipleProducers)
+    {
+      _clear_bits(_ready, _slot(head), slots);
+    }
+    _head.store(_pack(static_cast<uint32_t>(_slot(head) + slots), static_cast<uint32_t>(_error(head) + errors)), std::memory_order_release);
+  }
+
+public:
+  /// \output_section Constructors
+  //! Constructs an empty queue.
+  basic_result_queue() noexcept
+  {
+    for(auto &w : _is_error)
+    {
+      w.store(0, std::memory_order_relaxed);
+    }
+    for(auto &w : _ready)
+    {
+      w.store(0, std::memory_order_relaxed);
+    }
+  }
+  basic_result_queue(const basic_result_queue &) = delete;
+  basic_result_queue(basic_result_queue &&) = delete;
+  basic_result_queue &operator=(const basic_result_queue &) = delete;
+  basic_result_queue &operator=(basic_result_queue &&) = delete;
+  //! Destroys any values still queued. There must be no concurrent use.
+  ~basic_result_queue() { clear(); }
+
+  /// \output_section Producers
+  //! Pushes a value. \returns False if the queue is full.
+  bool push_value(value_type &&v) noexcept
+  {
+    return _push(false, [&](uint32_t slot, uint32_t /*unused*/) { new(_value(slot)) R(std::move(v)); });  // NOLINT
+  }
+  //! Pushes an error. \returns False if the queue or the error ring is full.
+  bool push_error(error_type &&e) noexcept
+  {
+    return _push(true, [&](uint32_t /*unused*/, uint32_t error) { _errors[error & (ErrorCapacity - 1)] = std::move(e); });
+  }
+  //! Pushes a result, moving from it. \returns False if the queue, or if `r` is errored the error ring, is full.
+  bool push(result_type &&r) noexcept { return r.has_value() ? push_value(std::move(r).assume_value()) : push_error(std::move(r).assume_error()); }
+
+  /// \output_section Consumer
+  /*! Pops the result at the front of the queue.
+  \returns False if the queue is empty.
+  \effects Assigns the result popped to `out`.
+  */
+  bool pop(result_type &out)
+  {
+    const uint64_t head = _head.load(std::memory_order_relaxed);
+    if(_available(head, 1) == 0)
+    {
+      return false;
+    }
+    const size_t values = _value_run(head, 1);
+    if(values == 1)
+    {
+      R *v = _value(_slot(head));
+      out = result_type(in_place_type<value_type>, std::move(*v));
+      v->~R();
+    }
+    else
+    {
+      out = result_type(in_place_type<error_type>, std::move(_errors[_error(head) & (ErrorCapacity - 1)]));
+    }
+    _release(head, 1, 1 - values);
+    return true;
+  }
+  /*! Calls `f(value_type &&)` for each value at the front of the queue, stopping at the first error.
+  \returns The number of values drained.
+  \param f The callable to which values are moved. It must not throw.
+  \param max The most values to drain.
+  */
+  template <class F> size_t drain_values(F &&f, size_t max = ~size_t(0)) noexcept
+  {
+    const uint64_t head = _head.load(std::memory_order_relaxed);
+    const size_t values = _value_run(head, max);
+    for(size_t n = 0; n < values; n++)
+    {
+      R *v = _value(_slot(head) + n);
+      f(std::move(*v));
+      v->~R();
+    }
+    _release(head, values, 0);
+    return values;
+  }
+  /*! Discards the values at the front of the queue, stopping at the first error. For trivially destructible
+  `R` this does not touch the values at all.
+  \returns The number of values discarded.
+  \param max The most values to discard.
+  */
+  size_t skip_values(size_t max = ~size_t(0)) noexcept
+  {
+    const uint64_t head = _head.load(std::memory_order_relaxed);
+    const size_t values = _value_run(head, max);
+    if(!std::is_trivially_destructible<R>::value)
+    {
+      for(size_t n = 0; n < values; n++)
+      {
+        _value(_slot(head) + n)->~R();
+      }
+    }
+    _release(head, values, 0);
+    return values;
+  }
+  //! Pops everything in the queue. \returns The number of results discarded.
+  size_t clear() noexcept
+  {
+    size_t count = 0;
+    for(;;)
+    {
+      count += skip_values();
+      const uint64_t head = _head.load(std::memory_order_relaxed);
+      if(_available(head, 1) == 0)
+      {
+        return count;
+      }
+      // The front is an error
+      _release(head, 1, 1);
+      ++count;
+    }
+  }
+  //! True if the queue appears empty.
+  bool empty() const noexcept { return _available(_head.load(std::memory_order_relaxed), 1) == 0; }
+};
+
+//! A single producer single consumer `basic_result_queue`.
+template <class R, class S = std::error_code, size_t Capacity = 1024, size_t ErrorCapacity = 64> using spsc_result_queue = basic_result_queue<R, S, Capacity, ErrorCapacity, false>;
+//! A multiple producer single consumer `basic_result_queue`.
+template <class R, class S = std::error_code, size_t Capacity = 1024, size_t ErrorCapacity = 64> using mpsc_result_queue = basic_result_queue<R, S, Capacity, ErrorCapacity, true>;
+
+OUTCOME_V2_NAMESPACE_END
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+
+#endif
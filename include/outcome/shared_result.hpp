@@ -0,0 +1,277 @@
+/* Arrays of result slots in memory shared between processes
+(C) 2026 agent <agent@local> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_SHARED_RESULT_HPP
+#define OUTCOME_SHARED_RESULT_HPP
+
+#include "atomic_result.hpp"
+#include "category_registry.hpp"
+
+#include <cerrno>
+#include <cstdio>  // for snprintf
+#include <utility>  // for swap
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdocumentation"  // Standardese markup confuses clang
+#endif
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+namespace detail
+{
+  // What is stored in shared memory for a result<R>, which must contain no pointers
+  template <class R> struct shared_result_payload
+  {
+    bool has_value;
+    union {
+      R value;
+      encoded_error_code error;
+    };
+    explicit shared_result_payload(const R &v) noexcept : has_value(true), value(v) {}
+    explicit shared_result_payload(const std::error_code &ec) noexcept : has_value(false), error(_encode(ec)) {}
+
+  private:
+    // A category which cannot be registered is sent as id zero, which no category has
+    static encoded_error_code _encode(const std::error_code &ec) noexcept
+    {
+      auto e = encode_error_code(ec);
+      return e ? e.value() : encoded_error_code{0, ec.value()};
+    }
+  };
+}  // namespace detail
+
+/*! A fixed size array of single assignment `result<R>` slots in memory which can be shared between processes,
+for worker processes to return results to a supervisor without pipes or serialisation.
+
+The memory is an anonymous `memfd` on Linux, or else an immediately unlinked POSIX shared memory object, so it
+is freed when the last process unmaps it. Children forked after creation share the array; any other process
+can map it with `open()` from a duplicate of `fd()`. Each slot is published with the same atomic state machine as
+`atomic_result`, and waiting uses a process shared futex on Linux, else polling.
+
+The category of an error is carried as its id in the category registry, which is the same in every process. Errors
+in a category not registered in the receiving process arrive with their value intact, but in a category named
+"unknown". \sa `register_category()`.
+
+\tparam R The `value_type`, which must be trivially copyable as it is copied between processes as bytes.
+*/
+template <class R> class shared_result_array
+{
+  static_assert(std::is_trivially_copyable<R>::value, "R must be trivially copyable to be shared between processes");
+  static_assert(ATOMIC_INT_LOCK_FREE == 2, "std::atomic<uint32_t> must be lock free to be shared between processes");
+
+public:
+  //! The type of result published.
+  using result_type = result<R>;
+  //! The success type.
+  using value_type = R;
+
+private:
+  using _slot_type = detail::atomic_slot<detail::shared_result_payload<R>, true>;
+  struct _header
+  {
+    uint64_t magic, count, slot_size;
+  };
+  static constexpr uint64_t _magic = 0x746c75736572636fULL;  // "ocresult"
+  // Slots begin on a cache line of their own
+  static constexpr size_t _slots_offset = (sizeof(_header) + 63) & ~size_t(63);
+
+  int _fd{-1};
+  void *_addr{nullptr};
+  size_t _length{0};
+
+  shared_result_array() = default;
+  _slot_type *_slots() const noexcept { return reinterpret_cast<_slot_type *>(static_cast<char *>(_addr) + _slots_offset); }  // NOLINT
+  static std::error_code _errno() noexcept { return {errno, std::system_category()}; }
+  static int _create_fd() noexcept
+  {
+#if defined(__linux__) && defined(SYS_memfd_create)
+    const int mfd = static_cast<int>(::syscall(SYS_memfd_create, "outcome_shared_result_array", 1 /*MFD_CLOEXEC*/));
+    if(mfd != -1 || errno != ENOSYS)
+    {
+      return mfd;
+    }
+#endif
+    char name[64];
+    snprintf(name, sizeof(name), "/outcome_shared_result_array_%ld_%p", static_cast<long>(::getpid()), static_cast<void *>(name));
+    int fd = ::shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);  // NOLINT
+    if(fd != -1)
+    {
+      ::shm_unlink(name);
+    }
+    return fd;
+  }
+  result<void> _map(size_t length) noexcept
+  {
+    _length = length;
+    _addr = ::mmap(nullptr, _length, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0);
+    if(_addr == MAP_FAILED)  // NOLINT
+    {
+      _addr = nullptr;
+      return _errno();
+    }
+    return success();
+  }
+
+public:
+  /// \output_section Constructors
+  /*! Creates a new array of `count` empty slots in newly allocated shared memory.
+  \returns The array, or the system error which prevented its creation.
+  */
+  static result<shared_result_array> create(size_t count) noexcept
+  {
+    shared_result_array ret;
+    ret._fd = _create_fd();
+    if(ret._fd == -1)
+    {
+      return _errno();
+    }
+    const size_t length = _slots_offset + count * sizeof(_slot_type);
+    if(::ftruncate(ret._fd, static_cast<off_t>(length)) == -1)
+    {
+      return _errno();
+    }
+    auto mapped = ret._map(length);
+    if(!mapped)
+    {
+      return mapped.error();
+    }
+    for(size_t n = 0; n < count; n++)
+    {
+      new(ret._slots() + n) _slot_type;  // NOLINT
+    }
+    new(ret._addr) _header{_magic, count, sizeof(_slot_type)};  // NOLINT
+    return {std::move(ret)};
+  }
+  /*! Maps an existing array from a file descriptor referring to its shared memory, which is duplicated.
+  \returns The array, or the system error which prevented its mapping, or `errc::invalid_argument` if
+  `fd` does not refer to an array of this `R`.
+  */
+  static result<shared_result_array> open(int fd) noexcept
+  {
+    shared_result_array ret;
+    ret._fd = ::fcntl(fd, F_DUPFD_CLOEXEC, 0);
+    if(ret._fd == -1)
+    {
+      return _errno();
+    }
+    struct stat s;  // NOLINT
+    if(::fstat(ret._fd, &s) == -1)
+    {
+      return _errno();
+    }
+    if(static_cast<size_t>(s.st_size) < _slots_offset)
+    {
+      return std::make_error_code(std::errc::invalid_argument);
+    }
+    auto mapped = ret._map(static_cast<size_t>(s.st_size));
+    if(!mapped)
+    {
+      return mapped.error();
+    }
+    const auto *h = static_cast<const _header *>(ret._addr);
+    if(h->magic != _magic || h->slot_size != sizeof(_slot_type) || _slots_offset + h->count * sizeof(_slot_type) > ret._length)
+    {
+      return std::make_error_code(std::errc::invalid_argument);
+    }
+    return {std::move(ret)};
+  }
+  shared_result_array(const shared_result_array &) = delete;
+  //! Move constructor.
+  shared_result_array(shared_result_array &&o) noexcept : _fd(o._fd), _addr(o._addr), _length(o._length)
+  {
+    o._fd = -1;
+    o._addr = nullptr;
+    o._length = 0;
+  }
+  shared_result_array &operator=(const shared_result_array &) = delete;
+  //! Move assignment. Whatever this mapped is released when `o` is destroyed, which makes self move safe.
+  shared_result_array &operator=(shared_result_array &&o) noexcept
+  {
+    std::swap(_fd, o._fd);
+    std::swap(_addr, o._addr);
+    std::swap(_length, o._length);
+    return *this;
+  }
+  //! Unmaps the array from this process. The memory is freed once no process maps it.
+  ~shared_result_array()
+  {
+    if(_addr != nullptr)
+    {
+      ::munmap(_addr, _length);
+    }
+    if(_fd != -1)
+    {
+      ::close(_fd);
+    }
+  }
+
+  //! The file descriptor of the shared memory, which another process may pass to `open()`.
+  int fd() const noexcept { return _fd; }
+  //! The number of slots.
+  size_t size() const noexcept { return (_addr != nullptr) ? static_cast<size_t>(static_cast<const _header *>(_addr)->count) : 0; }
+
+  /// \output_section Producers
+  //! Publishes a value into slot `idx`. \returns False if a result has already been published there.
+  bool set_value(size_t idx, const value_type &v) noexcept { return _slots()[idx].emplace(v); }
+  //! Publishes an error into slot `idx`. \returns False if a result has already been published there.
+  bool set_error(size_t idx, const std::error_code &ec) noexcept { return _slots()[idx].emplace(ec); }
+  //! Publishes `r` into slot `idx`. \returns False if a result has already been published there.
+  bool set_result(size_t idx, const result_type &r) noexcept { return r.has_value() ? set_value(idx, r.assume_value()) : set_error(idx, r.assume_error()); }
+
+  /// \output_section Consumers
+  //! True if a result has been published into slot `idx`.
+  bool is_ready(size_t idx) const noexcept { return _slots()[idx].is_ready(); }
+  //! Blocks until a result has been published into slot `idx`. \returns A copy of the result.
+  result_type wait(size_t idx) const noexcept
+  {
+    const auto &p = static_cast<const _slot_type &>(_slots()[idx]).wait();
+    if(p.has_value)
+    {
+      return result_type(in_place_type<value_type>, p.value);
+    }
+    return decode_error_code(p.error);
+  }
+  //! Returns slot `idx` to empty for reuse. No process may be using the slot concurrently.
+  void reset(size_t idx) noexcept { _slots()[idx].reset(); }
+};
+
+OUTCOME_V2_NAMESPACE_END
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
+
+#endif  // !_WIN32
+
+#endif
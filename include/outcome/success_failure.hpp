@@ -31,7 +31,7 @@ http://www.boost.org/LICENSE_1_0.txt)
 #include <system_error>
 #include <type_traits>
 
-OUTCOME_V2_NAMESPACE_BEGIN
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
 
 namespace detail
 {
@@ -163,6 +163,37 @@ namespace trait
   */
   template <class T> constexpr bool has_exception_ptr_v = has_exception_ptr<T>::value;
 
+  /*! Trait for whether a type can be relocated, i.e. moved to a new address with its old
+  storage then reused without its destructor being called, by `memcpy()`.
+  Defaults to `std::is_trivially_copyable<T>`. `std::exception_ptr` is also trivially relocatable.
+  Specialise this for your own types where it is true, for example those owning heap memory
+  through a plain pointer. `result` and `outcome` are trivially relocatable when all of their
+  constituent types are.
+  */
+  template <class T> struct is_trivially_relocatable : std::is_trivially_copyable<detail::devoid<T>>
+  {
+  };
+  template <> struct is_trivially_relocatable<std::exception_ptr> : std::true_type
+  {
+  };
+  /*! Trait for whether a type can be relocated, i.e. moved to a new address with its old
+  storage then reused without its destructor being called, by `memcpy()`.
+  */
+  template <class T> constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+  /*! Trait for whether a `result` or `outcome` keeps its value constructed when it is not valued, clearing
+  it rather than destroying it, so any capacity the value owns is reused when it next becomes valued.
+  Defaults to false. Specialise this to true for default constructible container types, for example
+  `std::vector<T>`, where repeatedly flipping between value and error would otherwise free and reallocate.
+  The value is cleared using its `clear()` member function if it has one, else by assigning a default constructed value.
+  */
+  template <class T> struct retain_value_storage : std::false_type
+  {
+  };
+  /*! Trait for whether a `result` or `outcome` keeps its value constructed when it is not valued.
+  */
+  template <class T> constexpr bool retain_value_storage_v = retain_value_storage<T>::value;
+
 }  // namespace trait
 
 /*! Type sugar for implicitly constructing a `result<>` with a successful state.
@@ -429,6 +460,45 @@ namespace detail
   template <class EC, class E> struct is_failure_type<failure_type<EC, E>> : std::true_type
   {
   };
+  // Specialised by result.hpp and outcome.hpp
+  template <class T> struct is_result : std::false_type
+  {
+  };
+  template <class T> struct is_outcome : std::false_type
+  {
+  };
+  // Whether `result` or `outcome` type U constructs directly from a `failure_forwarder` of source T, specialised by result.hpp and outcome.hpp
+  template <class U, class T> struct accepts_failure_forwarder : std::false_type
+  {
+  };
+
+  /* Refers to a failed `result` or `outcome` being propagated by `OUTCOME_TRY`, so that the
+  `result` or `outcome` being returned can construct its error and exception directly from
+  the source's storage, rather than via a temporary `failure_type`. It must not outlive the
+  source, so only `try_operation_return_as()` makes these.
+  */
+  template <class T> class failure_forwarder
+  {
+    T &&_src;
+
+  public:
+    using source_type = std::decay_t<T>;
+    constexpr explicit failure_forwarder(T &&src) noexcept : _src(static_cast<T &&>(src)) {}
+    failure_forwarder(const failure_forwarder &) = delete;
+    failure_forwarder(failure_forwarder &&) = default;  // NOLINT
+    failure_forwarder &operator=(const failure_forwarder &) = delete;
+    failure_forwarder &operator=(failure_forwarder &&) = delete;
+    ~failure_forwarder() = default;
+
+    constexpr T &&source() const noexcept { return static_cast<T &&>(_src); }
+    /* For anything else into which the source's `failure_type` implicitly converts, such as user types
+    constructible from a `failure_type`. This is a template so that converting to the destination is the
+    only user defined conversion, exactly as if `as_failure()` had been returned.
+    */
+    OUTCOME_TEMPLATE(class U)
+    OUTCOME_TREQUIRES(OUTCOME_TPRED(!accepts_failure_forwarder<U, source_type>::value && std::is_convertible<decltype(std::declval<T>().as_failure()), U>::value))
+    constexpr operator U() const { return static_cast<T &&>(_src).as_failure(); }  // NOLINT
+  };
 }  // namespace detail
 
 OUTCOME_V2_NAMESPACE_END
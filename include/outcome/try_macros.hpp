@@ -0,0 +1,120 @@
+/* Try operation macros, usable after importing the Outcome C++ Module
+(C) 2026 agent <agent@local> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_TRY_MACROS_HPP
+#define OUTCOME_TRY_MACROS_HPP
+
+// Only macros may be defined here, as this may be included after importing Outcome as a C++ Module.
+// config.hpp is safe as it is in the global module fragment of the module interface.
+#include "config.hpp"
+
+//! \exclude
+#define OUTCOME_TRY_GLUE2(x, y) x##y
+//! \exclude
+#define OUTCOME_TRY_GLUE(x, y) OUTCOME_TRY_GLUE2(x, y)
+//! \exclude
+#define OUTCOME_TRY_UNIQUE_NAME OUTCOME_TRY_GLUE(__t, __COUNTER__)
+
+//! \exclude
+#define OUTCOME_TRYV2(unique, ...)                                                                                                                                                                                                                                                                                             \
+  auto && (unique) = (__VA_ARGS__);                                                                                                                                                                                                                                                                                            \
+  if(!(unique).has_value())                                                                                                                                                                                                                                                                                                    \
+  return OUTCOME_V2_NAMESPACE::try_operation_return_as(std::forward<decltype(unique)>(unique))
+//! \exclude
+#define OUTCOME_TRY2(unique, v, ...)                                                                                                                                                                                                                                                                                           \
+  OUTCOME_TRYV2(unique, __VA_ARGS__);                                                                                                                                                                                                                                                                                          \
+  auto && (v) = std::forward<decltype(unique)>(unique).value()
+
+//! \exclude
+#define OUTCOME_TRYV2_MOVE(unique, ...)                                                                                                                                                                                                                                                                                        \
+  auto && (unique) = (__VA_ARGS__);                                                                                                                                                                                                                                                                                            \
+  if(!(unique).has_value())                                                                                                                                                                                                                                                                                                    \
+  return OUTCOME_V2_NAMESPACE::try_operation_return_as(std::move(unique))
+//! \exclude
+#define OUTCOME_TRY2_MOVE(unique, v, ...)                                                                                                                                                                                                                                                                                      \
+  OUTCOME_TRYV2_MOVE(unique, __VA_ARGS__);                                                                                                                                                                                                                                                                                     \
+  auto && (v) = std::move(unique).value()
+
+/*! If the outcome returned by expression ... is not valued, propagate any
+failure by immediately returning that failure state immediately
+*/
+#define OUTCOME_TRYV(...) OUTCOME_TRYV2(OUTCOME_TRY_UNIQUE_NAME, __VA_ARGS__)
+
+/*! As `OUTCOME_TRYV`, but any failure is moved out of the outcome returned by expression ...
+even if it names an lvalue, instead of being copied. Use this when that outcome is not used again
+after the TRY, such as a local variable or a member of an object about to be destroyed. This
+avoids copying the `error_type` and, for `outcome`, the `exception_type`, whose copy for
+`std::exception_ptr` is an atomic reference count increment.
+*/
+#define OUTCOME_TRYV_MOVE(...) OUTCOME_TRYV2_MOVE(OUTCOME_TRY_UNIQUE_NAME, __VA_ARGS__)
+
+#if defined(__GNUC__) || defined(__clang__)
+
+/*! If the outcome returned by expression ... is not valued, propagate any
+failure by immediately returning that failure state immediately, else become the
+unwrapped value as an expression. This makes `OUTCOME_TRYX(expr)` an expression
+which can be used exactly like the `try` operator in other languages.
+
+\remarks This macro makes use of a proprietary extension in GCC and clang and is not
+portable. The macro is not made available on unsupported compilers,
+so you can test for its presence using `#ifdef OUTCOME_TRYX`.
+*/
+#define OUTCOME_TRYX(...)                                                                                                                                                                                                                                                                                                      \
+  ({                                                                                                                                                                                                                                                                                                                           \
+    auto &&res = (__VA_ARGS__);                                                                                                                                                                                                                                                                                                \
+    if(!res.has_value())                                                                                                                                                                                                                                                                                                       \
+      return OUTCOME_V2_NAMESPACE::try_operation_return_as(std::forward<decltype(res)>(res));                                                                                                                                                                                                                                  \
+    std::forward<decltype(res)>(res).value();                                                                                                                                                                                                                                                                                  \
+  \
+})
+
+/*! As `OUTCOME_TRYX`, but any failure is moved out of the outcome returned by expression ...
+even if it names an lvalue, instead of being copied, and the unwrapped value is an rvalue.
+
+\remarks This macro makes use of a proprietary extension in GCC and clang and is not
+portable. The macro is not made available on unsupported compilers,
+so you can test for its presence using `#ifdef OUTCOME_TRYX_MOVE`.
+*/
+#define OUTCOME_TRYX_MOVE(...)                                                                                                                                                                                                                                                                                                 \
+  ({                                                                                                                                                                                                                                                                                                                           \
+    auto &&res = (__VA_ARGS__);                                                                                                                                                                                                                                                                                                \
+    if(!res.has_value())                                                                                                                                                                                                                                                                                                       \
+      return OUTCOME_V2_NAMESPACE::try_operation_return_as(std::move(res));                                                                                                                                                                                                                                                    \
+    std::move(res).value();                                                                                                                                                                                                                                                                                                    \
+  \
+})
+#endif
+
+/*! If the outcome returned by expression ... is not valued, propagate any
+failure by immediately returning that failure immediately, else set *v* to the unwrapped value.
+*/
+#define OUTCOME_TRY(v, ...) OUTCOME_TRY2(OUTCOME_TRY_UNIQUE_NAME, v, __VA_ARGS__)
+
+/*! As `OUTCOME_TRY`, but any failure is moved out of the outcome returned by expression ...
+even if it names an lvalue, instead of being copied, and *v* binds to the value as an rvalue reference.
+The outcome must not be used again afterwards, other than to be destroyed or assigned to.
+*/
+#define OUTCOME_TRY_MOVE(v, ...) OUTCOME_TRY2_MOVE(OUTCOME_TRY_UNIQUE_NAME, v, __VA_ARGS__)
+
+#endif
@@ -30,7 +30,7 @@ http://www.boost.org/LICENSE_1_0.txt)
 #include <exception>
 #include <system_error>
 
-OUTCOME_V2_NAMESPACE_BEGIN
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
 
 #ifdef __cpp_exceptions
 /*! Utility function which tries to match the exception in the pointer provided
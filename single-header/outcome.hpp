@@ -7255,8 +7255,9 @@ OUTCOME_V2_NAMESPACE_END
 
 #endif
 #endif
-#include <iostream>
-#include <sstream>
+#include <istream>
+#include <ostream>
+#include <sstream>  // never <iostream>, which adds a static initialiser to every translation unit
 
 OUTCOME_V2_NAMESPACE_BEGIN
 
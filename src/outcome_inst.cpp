@@ -0,0 +1,33 @@
+/* Explicit instantiations of common result and outcome specialisations
+(C) 2026 agent <agent@local> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+
+/* Built into the `outcome_inst` library. Translation units which include
+outcome/extern_templates.hpp use these instantiations rather than their own.
+*/
+
+#define OUTCOME_INSTANTIATING_EXTERN_TEMPLATES
+#include "../include/outcome/extern_templates.hpp"
+
+OUTCOME_EXTERN_TEMPLATE_LIST(OUTCOME_INSTANTIATE_RESULT, OUTCOME_INSTANTIATE_OUTCOME)
@@ -0,0 +1,48 @@
+# Compares the preprocessed size and the compile time of a translation unit including the basic
+# header with one including the full header, and fails if the basic header is not smaller.
+#
+# cmake -DCOMPILER=g++ -DFLAGS="-std=c++14|-Iinclude" -DBASIC=outcome-basic.hpp -DFULL=outcome.hpp -DWORKDIR=. -P check-header-size.cmake
+cmake_minimum_required(VERSION 3.23)
+if(NOT COMPILER OR NOT BASIC OR NOT FULL OR NOT WORKDIR)
+  message(FATAL_ERROR "Usage: cmake -DCOMPILER=g++ -DFLAGS=\"-std=c++14|-Iinclude\" -DBASIC=outcome-basic.hpp -DFULL=outcome.hpp -DWORKDIR=. -P check-header-size.cmake")
+endif()
+string(REPLACE "|" ";" FLAGS "${FLAGS}")
+set(REPEATS 5)
+
+function(measure header)
+  get_filename_component(name "${header}" NAME_WE)
+  set(source "${WORKDIR}/${name}-size.cpp")
+  file(WRITE "${source}" "#include \"${header}\"\nint main() { return 0; }\n")
+  execute_process(COMMAND "${COMPILER}" ${FLAGS} -E -P "${source}" OUTPUT_FILE "${source}.i" RESULT_VARIABLE result ERROR_VARIABLE errors)
+  if(NOT result EQUAL 0)
+    message(FATAL_ERROR "Could not preprocess ${header}: ${errors}")
+  endif()
+  file(SIZE "${source}.i" bytes)
+  file(STRINGS "${source}.i" lines)
+  list(LENGTH lines lines)
+  # The best of several compiles, in microseconds
+  set(best)
+  foreach(n RANGE 1 ${REPEATS})
+    string(TIMESTAMP begin "%s%f" UTC)
+    execute_process(COMMAND "${COMPILER}" ${FLAGS} -fsyntax-only "${source}" RESULT_VARIABLE result ERROR_VARIABLE errors)
+    string(TIMESTAMP end "%s%f" UTC)
+    if(NOT result EQUAL 0)
+      message(FATAL_ERROR "Could not compile ${header}: ${errors}")
+    endif()
+    math(EXPR us "${end} - ${begin}")
+    if(NOT best OR us LESS best)
+      set(best ${us})
+    endif()
+  endforeach()
+  math(EXPR ms "${best} / 1000")
+  message(STATUS "${name}: ${bytes} bytes, ${lines} non-blank lines preprocessed, ${ms} ms to compile")
+  set(${name}_bytes ${bytes} PARENT_SCOPE)
+endfunction()
+
+measure("${BASIC}")
+measure("${FULL}")
+get_filename_component(basic "${BASIC}" NAME_WE)
+get_filename_component(full "${FULL}" NAME_WE)
+if(NOT ${basic}_bytes LESS ${full}_bytes)
+  message(FATAL_ERROR "${basic} preprocesses to ${${basic}_bytes} bytes, which is not smaller than the ${${full}_bytes} bytes of ${full}")
+endif()
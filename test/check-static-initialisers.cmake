@@ -0,0 +1,31 @@
+# Counts the static initialisers in object files, each compiled from a translation unit which
+# includes just one public header, and fails if there are any.
+#
+# cmake -DOBJDUMP=objdump -DPOINTER_SIZE=8 -DOBJECTS="a.o|b.o" -P check-static-initialisers.cmake
+cmake_minimum_required(VERSION 3.13)
+if(NOT OBJDUMP OR NOT POINTER_SIZE OR NOT OBJECTS)
+  message(FATAL_ERROR "Usage: cmake -DOBJDUMP=objdump -DPOINTER_SIZE=8 -DOBJECTS=\"a.o|b.o\" -P check-static-initialisers.cmake")
+endif()
+string(REPLACE "|" ";" OBJECTS "${OBJECTS}")
+set(failed)
+foreach(object ${OBJECTS})
+  execute_process(COMMAND "${OBJDUMP}" -h "${object}" RESULT_VARIABLE result OUTPUT_VARIABLE sections)
+  if(NOT result EQUAL 0)
+    message(FATAL_ERROR "${OBJDUMP} could not read ${object}")
+  endif()
+  get_filename_component(name "${object}" NAME)
+  set(count 0)
+  # Each line is 'idx name size vma lma offset align', and each entry is one pointer
+  string(REGEX MATCHALL "[.](init_array|ctors)[ \t]+[0-9a-fA-F]+" initialisers "${sections}")
+  foreach(initialiser ${initialisers})
+    string(REGEX REPLACE ".*[ \t]" "" size "${initialiser}")
+    math(EXPR count "${count} + 0x${size} / ${POINTER_SIZE}")
+  endforeach()
+  message(STATUS "${name}: ${count} static initialisers")
+  if(count GREATER 0)
+    list(APPEND failed "${name}")
+  endif()
+endforeach()
+if(failed)
+  message(FATAL_ERROR "Static initialisers are added by including: ${failed}")
+endif()
@@ -56,6 +56,7 @@ limits = {
 "min_option_next"                              : { 'gcc' :  5, 'clang' :  5, 'msvc' :  5 },
 "min_result_construct_value_move_destruct"     : { 'gcc' :  5, 'clang' :  5, 'msvc' :  5 },
 "min_result_next"                              : { 'gcc' :  5, 'clang' :  5, 'msvc' :  5 },
+"max_outcome_try_propagate"                    : { 'gcc' : 300 },
 }
 
 
@@ -87,7 +87,7 @@ _get_call_target_ = \
     }
 
 _is_our_function_ = \
-    { 'objdump' : lambda f: lambda l: (f in l) and ('-0x' not in l)
+    { 'objdump' : lambda f: lambda l: (f in l) and ('-0x' not in l) and ('_GLOBAL__sub_I_' not in l)
     , 'dumpbin' : lambda f: lambda l: (f in l) and ('?dtor' not in l)
     }
 
@@ -0,0 +1,37 @@
+#include "../../include/outcome.hpp"
+
+#ifdef __GNUC__
+#define WEAK __attribute__((weak))
+#else
+#define WEAK
+#endif
+
+using namespace OUTCOME_V2_NAMESPACE;
+extern outcome<int> unknown() WEAK;
+
+// Propagates a failure of outcome<int> through N nested outcome<long>
+template <int N> inline outcome<long> propagate()
+{
+  OUTCOME_TRY(v, propagate<N - 1>());
+  return v + 1;
+}
+template <> inline outcome<long> propagate<0>()
+{
+  OUTCOME_TRY(v, unknown());
+  return v;
+}
+
+extern QUICKCPPLIB_NOINLINE outcome<long> test1()
+{
+  return propagate<8>();
+}
+extern QUICKCPPLIB_NOINLINE void test2()
+{
+}
+
+int main(void)
+{
+  outcome<long> m(test1());
+  test2();
+  return 0;
+}
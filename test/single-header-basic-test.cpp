@@ -0,0 +1,31 @@
+#include "../single-header/outcome-basic.hpp"
+
+#ifdef OUTCOME_OUTCOME_HPP
+#error outcome-basic.hpp must not include outcome.hpp
+#endif
+#ifdef OUTCOME_IOSTREAM_SUPPORT_HPP
+#error outcome-basic.hpp must not include iostream_support.hpp
+#endif
+
+namespace outcome = OUTCOME_V2_NAMESPACE;
+
+static outcome::result<int> parse(const char *s)
+{
+  if(s == nullptr)
+  {
+    return std::errc::invalid_argument;
+  }
+  return *s - '0';
+}
+
+static outcome::result<int> twice(const char *s)
+{
+  OUTCOME_TRY(v, parse(s));
+  return v * 2;
+}
+
+int main()
+{
+  auto a = twice("4"), b = twice(nullptr);
+  return (a && a.value() == 8 && !b && b.error() == std::errc::invalid_argument) ? 0 : 1;
+}
@@ -0,0 +1,98 @@
+/* Unit testing for outcomes
+(C) 2026 agent <agent@local> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/atomic_result.hpp"
+#include "quickcpplib/include/boost/test/unit_test.hpp"
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / atomic_result / single, "Tests that atomic_result is single assignment")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  atomic_result<std::string> a;
+  BOOST_CHECK(!a.is_ready());
+  BOOST_CHECK(a.try_get() == nullptr);
+  BOOST_CHECK(a.set_value("hello"));
+  BOOST_CHECK(a.is_ready());
+  BOOST_CHECK(!a.set_error(std::make_error_code(std::errc::invalid_argument)));
+  BOOST_CHECK(!a.emplace(std::errc::invalid_argument));
+  BOOST_CHECK(a.try_get() == &a.wait());
+  BOOST_CHECK(a.wait().value() == "hello");
+  a.reset();
+  BOOST_CHECK(!a.is_ready());
+  BOOST_CHECK(a.set_error(std::make_error_code(std::errc::invalid_argument)));
+  BOOST_CHECK(a.wait().error() == std::errc::invalid_argument);
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / atomic_result / threads, "Tests that atomic_result publishes results from many producers to many consumers")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  static constexpr size_t slots = 1000, producers = 4, consumers = 4;
+  std::unique_ptr<atomic_result<std::string>[]> results(new atomic_result<std::string>[slots]);
+  std::vector<std::thread> threads;
+  std::vector<size_t> published(producers), seen(consumers);
+  for(size_t n = 0; n < consumers; n++)
+  {
+    threads.emplace_back([&, n] {
+      // Each consumer waits on every slot, so many are usually blocked on the same one
+      for(size_t i = 0; i < slots; i++)
+      {
+        const auto &r = results[i].wait();
+        if(r.has_value() ? r.value() == std::to_string(i) : (i % 7 == 0 && r.error() == std::errc::invalid_argument))
+        {
+          seen[n]++;
+        }
+      }
+    });
+  }
+  for(size_t n = 0; n < producers; n++)
+  {
+    threads.emplace_back([&, n] {
+      // All producers race to publish every slot, only one may succeed for each
+      for(size_t i = 0; i < slots; i++)
+      {
+        if(i % 7 == 0 ? results[i].set_error(std::make_error_code(std::errc::invalid_argument)) : results[i].set_value(std::to_string(i)))
+        {
+          published[n]++;
+        }
+      }
+    });
+  }
+  for(auto &t : threads)
+  {
+    t.join();
+  }
+  size_t total = 0;
+  for(auto p : published)
+  {
+    total += p;
+  }
+  BOOST_CHECK(total == slots);
+  for(auto s : seen)
+  {
+    BOOST_CHECK(s == slots);
+  }
+}
@@ -0,0 +1,144 @@
+/* Unit testing for outcomes
+(C) 2026 agent <agent@local> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/backtrace_sampling.hpp"
+#include "../../include/outcome/outcome.hpp"
+#include "quickcpplib/include/boost/test/unit_test.hpp"
+
+#include <iostream>
+#include <thread>
+
+namespace backtrace_sampling_test
+{
+  // Use the error_code type as the ADL bridge for the hooks by creating a type here
+  struct error_code : public std::error_code
+  {
+    using std::error_code::error_code;
+    error_code() = default;
+    error_code(std::error_code ec)  // NOLINT
+    : std::error_code(ec)
+    {
+    }
+  };
+  template <class R> using result = OUTCOME_V2_NAMESPACE::result<R, error_code>;
+  template <class R> using outcome = OUTCOME_V2_NAMESPACE::outcome<R, error_code>;
+
+  static thread_local unsigned sampled;
+  template <class T, class U> inline void hook_result_construction(result<T> *res, U && /*unused*/) noexcept
+  {
+    if(OUTCOME_V2_NAMESPACE::hooks::sample_error_backtrace(res))
+    {
+      ++sampled;
+    }
+  }
+  template <class T, class U> inline void hook_outcome_construction(outcome<T> *res, U && /*unused*/) noexcept
+  {
+    if(OUTCOME_V2_NAMESPACE::hooks::sample_error_backtrace(res))
+    {
+      ++sampled;
+    }
+  }
+
+  QUICKCPPLIB_NOINLINE result<int> origin1() { return std::make_error_code(std::errc::invalid_argument); }
+  QUICKCPPLIB_NOINLINE result<int> origin2() { return std::make_error_code(std::errc::not_enough_memory); }
+  QUICKCPPLIB_NOINLINE result<int> success() { return 5; }
+}  // namespace backtrace_sampling_test
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / backtrace_sampling / sampling, "Tests that errored construction is sampled one in N")
+{
+  using namespace backtrace_sampling_test;
+  namespace hooks = OUTCOME_V2_NAMESPACE::hooks;
+  hooks::set_error_backtrace_sample_period(0);
+  sampled = 0;
+  for(int n = 0; n < 100; n++)
+  {
+    (void) origin1();
+  }
+  BOOST_CHECK(sampled == 0);
+  hooks::set_error_backtrace_sample_period(4);
+  BOOST_CHECK(hooks::error_backtrace_sample_period() == 4);
+  OUTCOME_V2_NAMESPACE::sampled_error_origins().reset_counts();
+  for(int n = 0; n < 100; n++)
+  {
+    (void) success();
+  }
+  BOOST_CHECK(sampled == 0);
+  unsigned attached = 0, visited = 0;
+  for(int n = 0; n < 100; n++)
+  {
+    result<int> r = (n & 1) ? origin1() : origin2();
+    if(hooks::spare_storage(&r) != 0)
+    {
+      ++attached;
+      if(OUTCOME_V2_NAMESPACE::sampled_error_backtraces().visit(&r, [](const OUTCOME_V2_NAMESPACE::error_backtrace &bt) { BOOST_CHECK(bt.items <= OUTCOME_V2_NAMESPACE::error_backtrace::max_frames); }))
+      {
+        ++visited;
+      }
+    }
+  }
+  BOOST_CHECK(sampled == 25);
+  BOOST_CHECK(attached == 25);
+  BOOST_CHECK(visited == 25);
+  // The countdown is per thread, not per type, so two errored results then two errored outcomes make one sample
+  (void) origin1();
+  (void) origin1();
+  outcome<int> o(std::make_error_code(std::errc::invalid_argument));
+  BOOST_CHECK(sampled == 25);
+  o = outcome<int>(std::make_error_code(std::errc::invalid_argument));
+  BOOST_CHECK(sampled == 26);
+
+  uint64_t total = 0;
+  for(const auto &e : OUTCOME_V2_NAMESPACE::sampled_error_origins().snapshot())
+  {
+    total += e.count;
+  }
+  BOOST_CHECK(total + OUTCOME_V2_NAMESPACE::sampled_error_origins().overflow() == 26);
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / backtrace_sampling / threads, "Tests that sampling is per thread")
+{
+  using namespace backtrace_sampling_test;
+  namespace hooks = OUTCOME_V2_NAMESPACE::hooks;
+  hooks::set_error_backtrace_sample_period(10);
+  std::atomic<unsigned> total{0};
+  std::thread threads[4];
+  for(auto &t : threads)
+  {
+    t = std::thread([&] {
+      sampled = 0;
+      for(int n = 0; n < 1000; n++)
+      {
+        (void) origin2();
+      }
+      total += sampled;
+    });
+  }
+  for(auto &t : threads)
+  {
+    t.join();
+  }
+  BOOST_CHECK(total == 400);
+  auto origins = OUTCOME_V2_NAMESPACE::sampled_error_origins().snapshot();
+  BOOST_REQUIRE(!origins.empty());
+  std::cout << "Most common error origin was sampled " << origins.front().count << " times with " << origins.front().backtrace.items << " frames" << std::endl;
+}
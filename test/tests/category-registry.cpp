@@ -0,0 +1,108 @@
+/* Unit testing for outcomes
+(C) 2026 agent <agent@local> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+// Small enough to test running out of room
+#define OUTCOME_CATEGORY_REGISTRY_SIZE 16
+
+#include "../../include/outcome/category_registry.hpp"
+#include "quickcpplib/include/boost/test/unit_test.hpp"
+
+#include <thread>
+#include <vector>
+
+namespace category_registry_test
+{
+  class named_category : public std::error_category
+  {
+    const char *_name;
+
+  public:
+    explicit named_category(const char *name)
+        : _name(name)
+    {
+    }
+    const char *name() const noexcept override { return _name; }
+    std::string message(int /*unused*/) const override { return _name; }
+  };
+}  // namespace category_registry_test
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / category_registry / ids, "Tests that the category registry gives categories stable ids")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  using category_registry_test::named_category;
+  // Ids are the FNV-1a hash of the name, and the standard categories are always known
+  static_assert(detail::category_name_hash("") == 0xcbf29ce484222325ULL, "");
+  static_assert(detail::category_name_hash("a") == 0xaf63dc4c8601ec8cULL, "");
+  BOOST_CHECK(category_id(std::generic_category()).value() == detail::category_name_hash("generic"));
+  BOOST_CHECK(find_category(detail::category_name_hash("system")) == &std::system_category());
+  BOOST_CHECK(find_category(1) == nullptr);
+
+  // Registration, including of a second instance of the same category
+  static const named_category foo("foo"), foo2("foo"), bar("bar");
+  BOOST_CHECK(register_category(foo).value() == detail::category_name_hash("foo"));
+  BOOST_CHECK(category_id(foo2).value() == detail::category_name_hash("foo"));
+  BOOST_CHECK(find_category(detail::category_name_hash("foo")) == &foo);
+
+  // Encoding and decoding through the wire format
+  char buffer[encoded_error_code::bytes];
+  encode_error_code(std::error_code(-5, foo2)).value().write(buffer);
+  BOOST_CHECK(decode_error_code(encoded_error_code::read(buffer)) == std::error_code(-5, foo));
+  encode_error_code(std::make_error_code(std::errc::invalid_argument)).value().write(buffer);
+  BOOST_CHECK(decode_error_code(encoded_error_code::read(buffer)) == std::errc::invalid_argument);
+  // Codes in an unregistered category keep their value
+  const std::error_code unknown = decode_error_code({detail::category_name_hash("baz"), 7});
+  BOOST_CHECK(unknown.category() == unknown_category() && unknown.value() == 7);
+
+  // The registry holds half its size, which is four standard categories, both instances of foo, bar and one more
+  BOOST_CHECK(category_id(bar));
+  static const named_category c1("c1"), c2("c2");
+  BOOST_CHECK(register_category(c1));
+  BOOST_CHECK(register_category(c2).error() == std::errc::no_buffer_space);
+  BOOST_CHECK(!encode_error_code(std::error_code(1, c2)));
+  BOOST_CHECK(category_id(bar).value() == detail::category_name_hash("bar"));
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / category_registry / threads, "Tests that the category registry can be used from many threads")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  std::vector<std::thread> threads;
+  std::atomic<bool> ok{true};
+  for(int n = 0; n < 4; n++)
+  {
+    threads.emplace_back([&] {
+      for(int i = 0; i < 10000; i++)
+      {
+        const std::error_code ec(i, (i % 2 != 0) ? std::generic_category() : std::future_category());
+        if(decode_error_code(encode_error_code(ec).value()) != ec)
+        {
+          ok = false;
+        }
+      }
+    });
+  }
+  for(auto &t : threads)
+  {
+    t.join();
+  }
+  BOOST_CHECK(ok);
+}
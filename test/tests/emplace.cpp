@@ -0,0 +1,201 @@
+/* Unit testing for outcomes
+(C) 2026 agent <agent@local> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/outcome.hpp"
+#include "quickcpplib/include/boost/test/unit_test.hpp"
+
+#include <stdexcept>
+#include <string>
+
+namespace emplace_test
+{
+  static int live, in_place_hooks;
+  struct counted
+  {
+    std::string v;
+    explicit counted(const char *s)
+        : v(s)
+    {
+      ++live;
+    }
+    counted(const counted &o)
+        : v(o.v)
+    {
+      ++live;
+    }
+    ~counted() { --live; }
+    friend bool operator==(const counted &a, const counted &b) noexcept { return a.v == b.v; }
+  };
+  struct error_code : public std::error_code
+  {
+    using std::error_code::error_code;
+    error_code() = default;
+    error_code(std::error_code ec)  // NOLINT
+    : std::error_code(ec)
+    {
+    }
+  };
+#ifdef __cpp_exceptions
+  // An error type whose reset to default construction can throw
+  struct throwing_error
+  {
+    static bool fail;
+    int v{0};
+    throwing_error()
+    {
+      if(fail)
+      {
+        throw std::runtime_error("reset");
+      }
+    }
+    explicit throwing_error(int x)
+        : v(x)
+    {
+    }
+  };
+  bool throwing_error::fail;
+#endif
+  template <class R> using hooked_result = OUTCOME_V2_NAMESPACE::result<R, error_code>;
+  template <class R> using hooked_outcome = OUTCOME_V2_NAMESPACE::outcome<R, error_code>;
+  template <class T, class U, class... Args> constexpr inline void hook_result_in_place_construction(hooked_result<T> * /*unused*/, OUTCOME_V2_NAMESPACE::in_place_type_t<U> /*unused*/, Args &&... /*unused*/) noexcept { ++in_place_hooks; }
+  template <class T, class U, class... Args> constexpr inline void hook_outcome_in_place_construction(hooked_outcome<T> * /*unused*/, OUTCOME_V2_NAMESPACE::in_place_type_t<U> /*unused*/, Args &&... /*unused*/) noexcept { ++in_place_hooks; }
+}  // namespace emplace_test
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / result / emplace, "Tests that result can be reused by emplacing values and errors")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  using namespace emplace_test;
+  static_assert(noexcept(std::declval<result<int> &>().emplace_value(5)), "");
+  static_assert(noexcept(std::declval<result<int> &>().emplace_error(std::make_error_code(std::errc::invalid_argument))), "");
+  {
+    hooked_result<counted> a(std::errc::invalid_argument);
+    in_place_hooks = 0;
+    counted &v = a.emplace_value("hello");
+    BOOST_CHECK(in_place_hooks == 1);
+    BOOST_CHECK(&v == &a.value());
+    BOOST_CHECK(a.value().v == "hello");
+    BOOST_CHECK(!a.has_error());
+    BOOST_CHECK(live == 1);
+    a.emplace_value("world");
+    BOOST_CHECK(a.value().v == "world");
+    BOOST_CHECK(live == 1);
+    // The error was reset, so equals a freshly constructed result
+    BOOST_CHECK(a == hooked_result<counted>(in_place_type<counted>, "world"));
+    hooks::set_spare_storage(&a, 78);
+    in_place_hooks = 0;
+    error_code &e = a.emplace_error(std::make_error_code(std::errc::not_enough_memory));
+    BOOST_CHECK(in_place_hooks == 1);
+    BOOST_CHECK(&e == &a.error());
+    BOOST_CHECK(a.error() == std::errc::not_enough_memory);
+    BOOST_CHECK(live == 0);
+    BOOST_CHECK(hooks::spare_storage(&a) == 78);
+    hooked_result<counted> f(std::errc::not_enough_memory);
+    hooks::set_spare_storage(&f, 78);
+    BOOST_CHECK(a == f);
+  }
+  BOOST_CHECK(live == 0);
+
+  result<void> b(std::errc::invalid_argument);
+  b.emplace_value();
+  BOOST_CHECK(b);
+  result<int, void> c(5);
+  c.emplace_error();
+  BOOST_CHECK(c.has_error());
+  int x = 5;
+  result<int &> d(std::errc::invalid_argument);
+  BOOST_CHECK(&d.emplace_value(x) == &x);
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / outcome / emplace, "Tests that outcome can be reused by emplacing values, errors and exceptions")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  using namespace emplace_test;
+  {
+    hooked_outcome<counted> a(std::errc::invalid_argument);
+    in_place_hooks = 0;
+    a.emplace_value("hello");
+    BOOST_CHECK(a.value().v == "hello");
+    BOOST_CHECK(live == 1);
+    a.emplace_exception();
+    BOOST_CHECK(a.has_exception() && !a.has_error() && !a.has_value());
+    BOOST_CHECK(live == 0);
+    a.emplace_error(std::make_error_code(std::errc::not_enough_memory));
+    BOOST_CHECK(a.has_error() && !a.has_exception());
+    BOOST_CHECK(a == hooked_outcome<counted>(std::errc::not_enough_memory));
+    BOOST_CHECK(in_place_hooks == 3);
+  }
+  BOOST_CHECK(live == 0);
+#ifdef __cpp_exceptions
+  outcome<int> b(std::errc::invalid_argument);
+  b.emplace_exception(std::make_exception_ptr(std::runtime_error("hello")));
+  BOOST_CHECK(b.has_exception() && !b.has_error());
+  b.emplace_value(5);
+  BOOST_CHECK(b.value() == 5);
+  BOOST_CHECK(b == outcome<int>(5));
+#endif
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / result / emplace_throwing_error, "Tests that a throwing error reset during emplace_value never leaves both value and error present")
+{
+#ifdef __cpp_exceptions
+  using namespace OUTCOME_V2_NAMESPACE;
+  using namespace emplace_test;
+  {
+    result<counted, throwing_error, policy::terminate> a(in_place_type<throwing_error>, 5);
+    throwing_error::fail = true;
+    try
+    {
+      a.emplace_value("hello");
+      BOOST_CHECK(false);
+    }
+    catch(const std::runtime_error & /*unused*/)
+    {
+    }
+    throwing_error::fail = false;
+    BOOST_CHECK(a.has_error() && !a.has_value());
+    BOOST_CHECK(a.error().v == 5);
+    BOOST_CHECK(live == 0);
+    a.emplace_value("hello");
+    BOOST_CHECK(a.has_value() && !a.has_error());
+    BOOST_CHECK(live == 1);
+  }
+  BOOST_CHECK(live == 0);
+  {
+    outcome<counted, throwing_error, std::exception_ptr, policy::terminate> a(in_place_type<throwing_error>, 5);
+    throwing_error::fail = true;
+    try
+    {
+      a.emplace_value("hello");
+      BOOST_CHECK(false);
+    }
+    catch(const std::runtime_error & /*unused*/)
+    {
+    }
+    throwing_error::fail = false;
+    BOOST_CHECK(a.has_error() && !a.has_value());
+    BOOST_CHECK(a.error().v == 5);
+    BOOST_CHECK(live == 0);
+  }
+  BOOST_CHECK(live == 0);
+#endif
+}
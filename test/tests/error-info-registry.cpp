@@ -0,0 +1,188 @@
+/* Unit testing for outcomes
+(C) 2026 agent <agent@local> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/error_info_registry.hpp"
+#include "quickcpplib/include/boost/test/unit_test.hpp"
+
+#include <cstring>
+#include <iostream>
+#include <new>
+#include <thread>
+#include <vector>
+
+namespace error_info_registry_test
+{
+  struct extended_error_info
+  {
+    unsigned value{0}, check{0};
+    extended_error_info() = default;
+    explicit extended_error_info(unsigned v)
+        : value(v)
+        , check(~v)
+    {
+    }
+  };
+
+  // Use the error_code type as the ADL bridge for the hooks by creating a type here
+  struct error_code : public std::error_code
+  {
+    using std::error_code::error_code;
+    error_code() = default;
+    error_code(std::error_code ec)  // NOLINT
+    : std::error_code(ec)
+    {
+    }
+  };
+  template <class R> using result = OUTCOME_V2_NAMESPACE::result<R, error_code>;
+
+  inline OUTCOME_V2_NAMESPACE::error_info_registry<extended_error_info, 64> &registry() { return OUTCOME_V2_NAMESPACE::global_error_info_registry<extended_error_info, 64>(); }
+
+  // Attach a record to every errored result constructed
+  template <class T, class U> inline void hook_result_construction(result<T> *res, U && /*unused*/) noexcept
+  {
+    if(res->has_error())
+    {
+      registry().attach(res, static_cast<unsigned>(res->assume_error().value()));
+    }
+  }
+}  // namespace error_info_registry_test
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / error_info_registry / basic, "Tests that the extended error info registry stores and retrieves records and detects staleness")
+{
+  using namespace error_info_registry_test;
+  OUTCOME_V2_NAMESPACE::error_info_registry<extended_error_info, 16> reg;
+  auto h = reg.emplace(78U);
+  BOOST_REQUIRE(h != 0);
+  extended_error_info eei;
+  BOOST_CHECK(reg.get(h, eei));
+  BOOST_CHECK(eei.value == 78 && eei.check == ~78U);
+  unsigned seen = 0;
+  BOOST_CHECK(reg.visit_short(reg.to_short_handle(h), [&](const extended_error_info &v) { seen = v.value; }));
+  BOOST_CHECK(seen == 78);
+  BOOST_CHECK(!reg.visit(0, [](const extended_error_info & /*unused*/) {}));
+  BOOST_CHECK(!reg.visit_short(0, [](const extended_error_info & /*unused*/) {}));
+  // Wrap the registry so the record gets reused
+  for(unsigned n = 0; n < 16; n++)
+  {
+    BOOST_CHECK(reg.emplace(n) != 0);
+  }
+  BOOST_CHECK(!reg.get(h, eei));
+  BOOST_CHECK(!reg.visit_short(reg.to_short_handle(h), [](const extended_error_info & /*unused*/) {}));
+  // A pinned record is never reused
+  auto h2 = reg.emplace(5U);
+  BOOST_CHECK(reg.visit(h2, [&](const extended_error_info & /*unused*/) {
+    for(unsigned n = 0; n < 64; n++)
+    {
+      BOOST_CHECK(reg.emplace(n) != 0);
+    }
+    BOOST_CHECK(reg.get(h2, eei));
+  }));
+  BOOST_CHECK(eei.value == 5);
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / error_info_registry / storage_duration, "Tests that a registry in dirty memory starts empty")
+{
+  using namespace error_info_registry_test;
+  using registry_type = OUTCOME_V2_NAMESPACE::error_info_registry<extended_error_info, 16>;
+  alignas(registry_type) unsigned char buffer[sizeof(registry_type)];
+  memset(buffer, 0xff, sizeof(buffer));
+  auto *reg = new(buffer) registry_type;
+  unsigned visited = 0;
+  for(uint32_t generation = 0; generation < 65536; generation += 255)
+  {
+    for(uint32_t index = 0; index < 16; index++)
+    {
+      visited += reg->visit((generation << 16U) | index, [](const extended_error_info & /*unused*/) {});
+    }
+  }
+  BOOST_CHECK(visited == 0);
+  auto h = reg->emplace(5U);
+  BOOST_CHECK(h != 0);
+  BOOST_CHECK(reg->visit(h, [](const extended_error_info &v) { BOOST_CHECK(v.value == 5); }));
+  reg->~registry_type();
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / error_info_registry / result, "Tests that extended error info attached to a result can be read from another thread")
+{
+  using namespace error_info_registry_test;
+  result<int> r(std::make_error_code(std::errc::invalid_argument));
+  BOOST_CHECK(OUTCOME_V2_NAMESPACE::hooks::spare_storage(&r) != 0);
+  result<int> r2(5);
+  BOOST_CHECK(OUTCOME_V2_NAMESPACE::hooks::spare_storage(&r2) == 0);
+  unsigned seen = 0;
+  std::thread([&] { registry().visit(&r, [&](const extended_error_info &v) { seen = v.value; }); }).join();
+  BOOST_CHECK(seen == static_cast<unsigned>(EINVAL));
+  BOOST_CHECK(!registry().visit(&r2, [](const extended_error_info & /*unused*/) {}));
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / error_info_registry / threads, "Tests that the extended error info registry is safe to use concurrently from many threads")
+{
+  using namespace error_info_registry_test;
+  std::atomic<unsigned> torn{0}, found{0};
+  std::atomic<bool> done{false};
+  std::vector<std::thread> threads;
+  std::vector<std::atomic<uint32_t>> handles(8);
+  for(auto &h : handles)
+  {
+    h.store(0);
+  }
+  for(unsigned t = 0; t < 4; t++)
+  {
+    threads.emplace_back([&, t] {
+      for(unsigned n = 0; n < 20000; n++)
+      {
+        result<int> r(std::error_code(static_cast<int>(t * 100000 + n), std::generic_category()));
+        handles[(t + n) % handles.size()].store(OUTCOME_V2_NAMESPACE::hooks::spare_storage(&r), std::memory_order_relaxed);
+      }
+    });
+  }
+  for(unsigned t = 0; t < 4; t++)
+  {
+    threads.emplace_back([&] {
+      while(!done.load(std::memory_order_relaxed))
+      {
+        for(auto &h : handles)
+        {
+          registry().visit_short(static_cast<uint16_t>(h.load(std::memory_order_relaxed)), [&](const extended_error_info &v) {
+            ++found;
+            if(v.check != ~v.value)
+            {
+              ++torn;
+            }
+          });
+        }
+      }
+    });
+  }
+  for(unsigned t = 0; t < 4; t++)
+  {
+    threads[t].join();
+  }
+  done = true;
+  for(unsigned t = 4; t < 8; t++)
+  {
+    threads[t].join();
+  }
+  BOOST_CHECK(torn == 0);
+  std::cout << "Readers successfully visited " << found << " records" << std::endl;
+}
@@ -0,0 +1,60 @@
+/* Unit testing for outcomes
+(C) 2026 agent <agent@local> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/extern_templates.hpp"
+#include "quickcpplib/include/boost/test/unit_test.hpp"
+
+// This test is not linked to outcome_inst, so it instantiates the specialisations it declared extern itself
+OUTCOME_EXTERN_TEMPLATE_LIST(OUTCOME_INSTANTIATE_RESULT, OUTCOME_INSTANTIATE_OUTCOME)
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / outcome / extern - templates, "Tests that the extern template specialisations behave like any other")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  const std::error_code ec(5, std::generic_category());
+  result<void> a(success()), b(ec);
+  result<int> c(5), d(ec);
+  result<std::string> e("niall"), f(ec);
+  outcome<void> g(success()), h(ec);
+  BOOST_CHECK(a && !b && b.error() == ec);
+  BOOST_CHECK(c.value() == 5 && d.error() == ec);
+  BOOST_CHECK(e.value() == "niall" && f.error() == ec);
+  BOOST_CHECK(g && h.error() == ec);
+  e = f;
+  BOOST_CHECK(e == f);
+  c.swap(d);
+  BOOST_CHECK(c.error() == ec && d.value() == 5);
+#ifdef __cpp_exceptions
+  BOOST_CHECK(h.failure() != nullptr);
+  outcome<void> i(std::make_exception_ptr(std::runtime_error("hi")));
+  BOOST_CHECK(i.has_exception() && i.failure() == i.exception());
+  try
+  {
+    f.value();
+    BOOST_CHECK(false);
+  }
+  catch(const std::system_error &ex)
+  {
+    BOOST_CHECK(ex.code() == ec);
+  }
+#endif
+}
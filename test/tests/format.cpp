@@ -0,0 +1,86 @@
+/* Unit testing for outcomes
+(C) 2026 agent <agent@local> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/format.hpp"
+#include "../../include/outcome/iostream_support.hpp"
+#include "quickcpplib/include/boost/test/unit_test.hpp"
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / outcome / format, "Tests that iostream free formatting matches the iostream support")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  enum class colour : short
+  {
+    red = 7
+  };
+  const std::error_code ec(5, std::generic_category());
+  result<int> a(-5), b(ec);
+  result<double, long> c(success(2.5)), d(failure(-78L));
+  result<void> e(success()), f(ec);
+  result<std::string, colour> g("niall"), h(failure(colour::red));
+  result<unsigned long long, void> i(18446744073709551615ULL);
+  BOOST_CHECK(to_string(a) == print(a));
+  BOOST_CHECK(to_string(b) == print(b));
+  BOOST_CHECK(to_string(c) == print(c));
+  BOOST_CHECK(to_string(d) == print(d));
+  BOOST_CHECK(to_string(e) == print(e));
+  BOOST_CHECK(to_string(f) == print(f));
+  BOOST_CHECK(to_string(g) == "niall");
+  BOOST_CHECK(to_string(h) == "7");
+  BOOST_CHECK(to_string(i) == print(i));
+
+  outcome<int> j(5), k(ec);
+  BOOST_CHECK(to_string(j) == print(j));
+  BOOST_CHECK(to_string(k) == print(k));
+#ifdef __cpp_exceptions
+  outcome<int> l(std::make_exception_ptr(std::system_error(ec))), m(failure(ec, std::make_exception_ptr(std::runtime_error("boom"))));
+  BOOST_CHECK(to_string(l) == print(l));
+  BOOST_CHECK(to_string(m) == print(m));
+#endif
+
+  // Formatting truncates as snprintf() does
+  char buffer[8];
+  BOOST_CHECK(print_to(buffer, sizeof(buffer), g) == 5 && strcmp(buffer, "niall") == 0);
+  BOOST_CHECK(print_to(buffer, sizeof(buffer), b) == print(b).size() && strlen(buffer) == sizeof(buffer) - 1);
+  BOOST_CHECK(print_to(nullptr, 0, b) == print(b).size());
+  // Long messages are formatted in full
+  result<std::string> n(std::string(1000, 'x'));
+  BOOST_CHECK(to_string(n) == n.value());
+
+  // Serialisation matches operator<<, and so is read back by operator>>
+  auto stream = [](const auto &v) {
+    std::stringstream s;
+    s << v;
+    return s.str();
+  };
+  auto serialise = [](const auto &v) { return detail::format_to_string([&v](char *buffer, size_t len) { return serialise_to(buffer, len, v); }); };
+  BOOST_CHECK(serialise(a) == stream(a));
+  BOOST_CHECK(serialise(b) == stream(b));
+  BOOST_CHECK(serialise(c) == stream(c));
+  BOOST_CHECK(serialise(d) == stream(d));
+  outcome<int, std::string, long> o(success(5)), p(failure(""));
+  BOOST_CHECK(serialise(o) == stream(o));
+  std::stringstream s(serialise(c));
+  result<double, long> q(success(0.0));
+  s >> q;
+  BOOST_CHECK(q == c);
+}
@@ -0,0 +1,120 @@
+/* Unit testing for outcomes
+(C) 2026 agent <agent@local> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/future.hpp"
+#include "quickcpplib/include/boost/test/unit_test.hpp"
+
+#include <string>
+#include <thread>
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / future / basic, "Tests that promise and future publish an outcome through caller provided state")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  future_state<std::string> state;
+  {
+    auto p = state.get_promise();
+    auto f = state.get_future();
+    BOOST_CHECK(p.valid() && f.valid());
+    BOOST_CHECK(!f.is_ready());
+    BOOST_CHECK(p.set_value("hello"));
+    BOOST_CHECK(!p.set_error(std::make_error_code(std::errc::invalid_argument)));
+    BOOST_CHECK(f.is_ready());
+    BOOST_CHECK(f.wait().value() == "hello");
+    BOOST_CHECK(f.get().value() == "hello");
+    BOOST_CHECK(!f.valid());
+  }
+  state.reset();
+  {
+    // Errors travel without exceptions
+    auto p = state.get_promise();
+    auto f = state.get_future();
+    p.set_error(std::make_error_code(std::errc::invalid_argument));
+    auto o = f.get();
+    BOOST_CHECK(o.has_error() && !o.has_exception());
+    BOOST_CHECK(o.error() == std::errc::invalid_argument);
+  }
+  state.reset();
+  {
+    // Broken promise
+    auto f = state.get_future();
+    {
+      auto p = state.get_promise();
+      auto p2(std::move(p));
+      BOOST_CHECK(!p.valid() && p2.valid());
+    }
+    BOOST_CHECK(f.get().error() == std::future_errc::broken_promise);
+  }
+  state.reset();
+#ifdef __cpp_exceptions
+  {
+    // Broken promise where the error type cannot represent it
+    future_state<int, int> state2;
+    auto f = state2.get_future();
+    state2.get_promise();
+    auto o = f.get();
+    BOOST_CHECK(o.has_exception());
+    try
+    {
+      std::rethrow_exception(o.exception());
+    }
+    catch(const std::future_error &e)
+    {
+      BOOST_CHECK(e.code() == std::future_errc::broken_promise);
+    }
+  }
+#endif
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / future / threads, "Tests that promise and future work across threads")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  for(int n = 0; n < 1000; n++)
+  {
+    future_state<int> ping, pong;
+    auto ping_promise = ping.get_promise();
+    auto pong_future = pong.get_future();
+    std::thread t([&ping, &pong] {
+      auto r = ping.get_future().get();
+      auto p = pong.get_promise();
+      if(r)
+      {
+        p.set_value(r.value() + 1);
+      }
+      else
+      {
+        p.set_error(r.error());
+      }
+    });
+    if(n % 3 == 0)
+    {
+      ping_promise.set_error(std::make_error_code(std::errc::invalid_argument));
+      BOOST_CHECK(pong_future.get().error() == std::errc::invalid_argument);
+    }
+    else
+    {
+      ping_promise.set_value(n);
+      BOOST_CHECK(pong_future.get().value() == n + 1);
+    }
+    t.join();
+  }
+}
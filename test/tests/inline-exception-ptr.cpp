@@ -0,0 +1,176 @@
+/* Unit testing for outcomes
+(C) 2026 agent <agent@local> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/inline_exception_ptr.hpp"
+#include "../../include/outcome/iostream_support.hpp"
+#include "quickcpplib/include/boost/test/unit_test.hpp"
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+namespace inline_exception_ptr_test
+{
+  static int live;
+  struct counted_error : std::exception
+  {
+    int code;
+    explicit counted_error(int c)
+        : code(c)
+    {
+      ++live;
+    }
+    counted_error(const counted_error &o) noexcept : std::exception(o), code(o.code) { ++live; }
+    ~counted_error() override { --live; }
+    const char *what() const noexcept override { return "counted_error"; }
+    friend bool operator==(const counted_error &a, const counted_error &b) noexcept { return a.code == b.code; }
+  };
+  struct big_error : std::runtime_error
+  {
+    char padding[256];
+    big_error()
+        : std::runtime_error("big_error")
+        , padding{}
+    {
+    }
+  };
+}  // namespace inline_exception_ptr_test
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / inline_exception_ptr / storage, "Tests that inline_exception_ptr stores small exceptions inline and large ones in a std::exception_ptr")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  using namespace inline_exception_ptr_test;
+  using ptr = inline_exception_ptr<>;
+  static_assert(ptr::stores_inline<std::runtime_error>::value, "");
+  static_assert(ptr::stores_inline<std::system_error>::value, "");
+  static_assert(!ptr::stores_inline<big_error>::value, "");
+  static_assert(trait::has_exception_ptr_v<ptr>, "");
+  static_assert(std::is_nothrow_move_constructible<ptr>::value, "");
+
+  ptr a;
+  BOOST_CHECK(!a);
+  BOOST_CHECK(a == nullptr);
+  BOOST_CHECK(a == ptr());
+  BOOST_CHECK(a.what() == nullptr);
+  BOOST_CHECK(!make_exception_ptr(a));
+  {
+    live = 0;
+    ptr b = make_inline_exception_ptr<counted_error>(5);
+    BOOST_CHECK(b && b.is_inline());
+    BOOST_CHECK(std::string(b.what()) == "counted_error");
+    ptr c(b);
+    BOOST_CHECK(live == 2);
+    BOOST_CHECK(b == c);
+    BOOST_CHECK(b != a);
+    ptr d(std::move(c));
+    BOOST_CHECK(!c);
+    BOOST_CHECK(live == 2);
+    d = a;
+    BOOST_CHECK(live == 1);
+    swap(b, d);
+    BOOST_CHECK(!b && d);
+    BOOST_CHECK(make_inline_exception_ptr<counted_error>(6) != d);
+  }
+  BOOST_CHECK(live == 0);
+
+  // Runtime errors don't define operator== so never compare equal
+  ptr h = make_inline_exception_ptr<std::runtime_error>("runtime");
+  BOOST_CHECK(h != ptr(h));
+
+#ifdef __cpp_exceptions
+  // std::make_exception_ptr() returns null with exceptions disabled
+  ptr e = make_inline_exception_ptr<big_error>();
+  BOOST_CHECK(e && !e.is_inline());
+  BOOST_CHECK(std::string(e.what()) == "big_error");
+  ptr f(e);
+  BOOST_CHECK(e == f);  // same std::exception_ptr
+  ptr g(std::make_exception_ptr(std::logic_error("logic")));
+  BOOST_CHECK(g && !g.is_inline());
+  BOOST_CHECK(std::string(g.what()) == "logic");
+
+  try
+  {
+    h.rethrow();
+  }
+  catch(const std::runtime_error &x)
+  {
+    BOOST_CHECK(std::string(x.what()) == "runtime");
+  }
+  try
+  {
+    std::rethrow_exception(policy::exception_ptr(e));
+  }
+  catch(const big_error &x)
+  {
+    BOOST_CHECK(std::string(x.what()) == "big_error");
+  }
+#endif
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / inline_exception_ptr / outcome, "Tests that inline_exception_ptr works as the exception type of outcome")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  using namespace inline_exception_ptr_test;
+  using ptr = inline_exception_ptr<>;
+  using outcome_type = outcome<int, std::error_code, ptr>;
+  static_assert(std::is_nothrow_move_constructible<outcome_type>::value, "");
+
+  outcome_type a(5), b(std::make_error_code(std::errc::invalid_argument)), c(make_inline_exception_ptr<std::runtime_error>("hello"));
+  BOOST_CHECK(a.value() == 5);
+  BOOST_CHECK(b.has_error());
+  BOOST_CHECK(c.has_exception());
+  BOOST_CHECK(c.exception().is_inline());
+  outcome_type d(c);
+  BOOST_CHECK(d.has_exception());
+  BOOST_CHECK(std::string(d.exception().what()) == "hello");
+  BOOST_CHECK(!a.failure());
+
+#ifdef __cpp_exceptions
+  BOOST_CHECK(b.failure());
+  BOOST_CHECK(c.failure());
+  outcome_type e(failure(std::make_error_code(std::errc::invalid_argument), std::make_exception_ptr(std::logic_error("logic"))));
+  BOOST_CHECK(e.has_error() && e.has_exception());
+  BOOST_CHECK(!e.exception().is_inline());
+  std::stringstream s;
+  s << print(c);
+  BOOST_CHECK(s.str() == "std::exception: hello");
+  try
+  {
+    (void) c.value();
+    BOOST_CHECK(false);
+  }
+  catch(const std::runtime_error &x)
+  {
+    BOOST_CHECK(std::string(x.what()) == "hello");
+  }
+  try
+  {
+    (void) b.value();
+    BOOST_CHECK(false);
+  }
+  catch(const std::system_error &x)
+  {
+    BOOST_CHECK(x.code() == std::errc::invalid_argument);
+  }
+#endif
+}
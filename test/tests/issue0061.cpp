@@ -61,8 +61,13 @@ BOOST_OUTCOME_AUTO_TEST_CASE(issues / 61 / result, "result<T1, E1> does not comp
   BOOST_CHECK(b == a);     // udt2 will compare to udt1
   BOOST_CHECK(!(b != a));  // udt2 will compare to udt1
   BOOST_CHECK(a != _a);
+#ifdef __cpp_impl_three_way_comparison
+  BOOST_CHECK(!(a != b));  // C++ 20 rewrites udt1 == udt2 into udt2 == udt1
+  BOOST_CHECK(a == b);     // C++ 20 rewrites udt1 == udt2 into udt2 == udt1
+#else
   BOOST_CHECK(a != b);     // udt1 will NOT compare to udt2, always say they differ
   BOOST_CHECK(!(a == b));  // udt1 will NOT compare to udt2, always say they differ
+#endif
 
   result<void> c = success();
   result<void> d = success();
@@ -116,8 +121,13 @@ BOOST_OUTCOME_AUTO_TEST_CASE(issues / 61 / outcome, "outcome<T1, E1, P1> does no
   BOOST_CHECK(b == a);     // udt2 will compare to udt1
   BOOST_CHECK(!(b != a));  // udt2 will compare to udt1
   BOOST_CHECK(a != _a);
+#ifdef __cpp_impl_three_way_comparison
+  BOOST_CHECK(!(a != b));  // C++ 20 rewrites udt1 == udt2 into udt2 == udt1
+  BOOST_CHECK(a == b);     // C++ 20 rewrites udt1 == udt2 into udt2 == udt1
+#else
   BOOST_CHECK(a != b);     // udt1 will NOT compare to udt2, always say they differ
   BOOST_CHECK(!(a == b));  // udt1 will NOT compare to udt2, always say they differ
+#endif
 
   outcome<void> c = success();
   outcome<void> d = success();
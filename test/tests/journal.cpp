@@ -0,0 +1,126 @@
+/* Unit testing for outcomes
+(C) 2026 agent <agent@local> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/journal.hpp"
+#include "../../include/outcome/outcome.hpp"
+#include "quickcpplib/include/boost/test/unit_test.hpp"
+
+#ifndef _WIN32
+#include <dirent.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / journal / threads, "Tests that the journal records results from many threads across rotated segments")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  char dir[] = "/tmp/outcome_journal_XXXXXX";
+  BOOST_REQUIRE(::mkdtemp(dir) != nullptr);
+  static constexpr int threads = 4, per_thread = 2000;
+  {
+    // Eight chunks per segment, so many segments are rotated through
+    auto journal = journal_writer::create(dir, 8 * journal_writer::chunk_records * sizeof(journal_record)).value();
+    std::vector<std::thread> ts;
+    for(int t = 0; t < threads; t++)
+    {
+      ts.emplace_back([&journal, t] {
+        for(int n = 0; n < per_thread; n++)
+        {
+          const int id = t * per_thread + n;
+          if(n % 3 == 0)
+          {
+            result<int> r(std::error_code(id, std::generic_category()));
+            hooks::set_spare_storage(&r, static_cast<uint16_t>(t));
+            journal.append(r, &id, sizeof(id)).value();
+          }
+          else if(n % 3 == 1)
+          {
+            outcome<int> o(id);
+            hooks::set_spare_storage(&o, static_cast<uint16_t>(t));
+            journal.append(o, &id, sizeof(id)).value();
+          }
+          else
+          {
+            // A payload too long to fit, in a result with no error code
+            char payload[64];
+            memcpy(payload, &id, sizeof(id));
+            result<int, long> r(failure(static_cast<long>(id)));
+            journal.append(r, payload, sizeof(payload)).value();
+          }
+        }
+      });
+    }
+    for(auto &t : ts)
+    {
+      t.join();
+    }
+  }
+  // Read back every segment
+  std::vector<int> seen(threads * per_thread);
+  size_t segments = 0;
+  bool ok = true;
+  DIR *d = ::opendir(dir);
+  BOOST_REQUIRE(d != nullptr);
+  while(const dirent *e = ::readdir(d))
+  {
+    if(strncmp(e->d_name, "journal-", 8) != 0)
+    {
+      continue;
+    }
+    const std::string path = std::string(dir) + "/" + e->d_name;
+    {
+      auto reader = journal_reader::open(path).value();
+      ++segments;
+      for(const journal_record &rec : reader)
+      {
+        int id;
+        memcpy(&id, rec.payload, sizeof(id));
+        const int t = id / per_thread, n = id % per_thread;
+        seen.at(id)++;
+        switch(n % 3)
+        {
+        case 0:
+          ok &= (rec.status & journal_record::status_have_error) != 0 && (rec.status & journal_record::status_error_is_errno) != 0;
+          ok &= rec.error() == std::error_code(id, std::generic_category()) && rec.spare_storage() == t && rec.payload_length == sizeof(id) && rec.payload_truncated == 0;
+          break;
+        case 1:
+          ok &= rec.status == ((static_cast<uint32_t>(t) << 16U) | journal_record::status_have_value) && rec.category == 0;
+          break;
+        default:
+          ok &= (rec.status & journal_record::status_have_error) != 0 && rec.category == 0 && rec.payload_length == sizeof(rec.payload) && rec.payload_truncated == 1;
+          break;
+        }
+      }
+    }
+    ::unlink(path.c_str());
+  }
+  ::closedir(d);
+  ::rmdir(dir);
+  BOOST_CHECK(ok);
+  BOOST_CHECK(segments >= threads * per_thread / (8 * journal_writer::chunk_records));
+  BOOST_CHECK(std::all_of(seen.begin(), seen.end(), [](int c) { return c == 1; }));
+  BOOST_CHECK(!journal_reader::open("/nonexistent/journal"));
+}
+#endif
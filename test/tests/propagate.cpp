@@ -81,3 +81,181 @@ BOOST_OUTCOME_AUTO_TEST_CASE(works / outcome / propagate, "Tests that the outcom
     (void) t1(5);
   }
 }
+
+namespace propagate_test
+{
+  static int copies;
+  // An exception payload which counts its copies
+  struct counted_ptr
+  {
+    int id{0};
+    counted_ptr() = default;
+    explicit counted_ptr(int i)
+        : id(i)
+    {
+    }
+    counted_ptr(const counted_ptr &o)
+        : id(o.id)
+    {
+      ++copies;
+    }
+    counted_ptr(counted_ptr &&) = default;
+    counted_ptr &operator=(const counted_ptr &o)
+    {
+      id = o.id;
+      ++copies;
+      return *this;
+    }
+    counted_ptr &operator=(counted_ptr &&) = default;
+    ~counted_ptr() = default;
+    friend bool operator==(const counted_ptr &a, const counted_ptr &b) noexcept { return a.id == b.id; }
+    friend bool operator!=(const counted_ptr &a, const counted_ptr &b) noexcept { return a.id != b.id; }
+    friend std::exception_ptr make_exception_ptr(const counted_ptr & /*unused*/) { return {}; }
+  };
+}  // namespace propagate_test
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / outcome / propagate_move, "Tests that the MOVE variants of TRY move the failure out of lvalues")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  using namespace propagate_test;
+  using outcome_type = outcome<std::string, std::error_code, counted_ptr>;
+  auto t0 = [](bool fail) -> outcome_type {
+    if(fail)
+    {
+      return counted_ptr(1);
+    }
+    return std::string("hello");
+  };
+  auto copying = [&](bool fail) -> outcome<size_t, std::error_code, counted_ptr> {
+    outcome_type o(t0(fail));
+    OUTCOME_TRY(v, o);
+    return v.size();
+  };
+  auto moving = [&](bool fail) -> outcome<size_t, std::error_code, counted_ptr> {
+    outcome_type o(t0(fail));
+    OUTCOME_TRY_MOVE(v, o);
+    std::string s(std::move(v));
+    BOOST_CHECK(s == "hello");
+    BOOST_CHECK(o.value().empty());  // NOLINT value was moved from
+    return s.size();
+  };
+  auto movingv = [&](bool fail) -> outcome<void, std::error_code, counted_ptr> {
+    outcome_type o(t0(fail));
+    OUTCOME_TRYV_MOVE(o);
+    return success();
+  };
+  copies = 0;
+  BOOST_CHECK(copying(true).has_exception());
+  BOOST_CHECK(copies == 1);
+  copies = 0;
+  BOOST_CHECK(moving(true).has_exception());
+  BOOST_CHECK(movingv(true).has_exception());
+  BOOST_CHECK(copies == 0);
+  BOOST_CHECK(moving(false).value() == 5);
+  BOOST_CHECK(movingv(false).has_value());
+
+  auto errored = [](int a) { return result<std::string>(std::error_code(a, std::generic_category())); };
+  auto t1 = [&](int a) -> result<int> {
+    result<std::string> r(errored(a));
+    OUTCOME_TRYV_MOVE(r);
+    return 0;
+  };
+  BOOST_CHECK(t1(5).error().value() == 5);
+#ifdef OUTCOME_TRYX_MOVE
+  auto t2 = [&](bool fail) -> outcome<size_t, std::error_code, counted_ptr> {
+    outcome_type o(t0(fail));
+    std::string s(OUTCOME_TRYX_MOVE(o));
+    return s.size();
+  };
+  copies = 0;
+  BOOST_CHECK(t2(true).has_exception());
+  BOOST_CHECK(t2(false).value() == 5);
+  BOOST_CHECK(copies == 0);
+#endif
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / outcome / propagate_forwarding, "Tests that TRY constructs the returned failure directly from the source")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  auto source = [](int a) { return outcome<int>(failure(std::error_code(a, std::generic_category()), std::make_exception_ptr(a))); };
+  auto t1 = [&](int a) -> outcome<long> {
+    OUTCOME_TRY(v, source(a));
+    return v;
+  };
+  auto t2 = [&](int a) -> outcome<std::string> {
+    outcome<long> o(t1(a));
+    OUTCOME_TRYV(o);
+    return std::string();
+  };
+  outcome<std::string> o(t2(5));
+  BOOST_CHECK(o.has_error());
+  BOOST_CHECK(o.error().value() == 5);
+#ifdef __cpp_exceptions
+  BOOST_CHECK(o.has_exception());
+#endif
+
+  // Which of error and exception are present comes from the source, not comparison to defaults
+  auto t3 = [](result<int> r) -> outcome<void> {
+    OUTCOME_TRYV(r);
+    return success();
+  };
+  BOOST_CHECK(t3(std::error_code()).has_error());
+  BOOST_CHECK(!t3(std::error_code()).has_exception());
+  auto t4 = [](outcome<int> r) -> result<long, std::error_code> {
+    result<int> x(r.has_error() ? result<int>(r.error()) : result<int>(5));
+    OUTCOME_TRYV(x);
+    return 6;
+  };
+  BOOST_CHECK(t4(std::make_error_code(std::errc::invalid_argument)).error() == std::errc::invalid_argument);
+  BOOST_CHECK(t4(5).value() == 6);
+
+  // The forwarder remains convertible to the failure_type of the source
+  result<int> r(std::make_error_code(std::errc::invalid_argument));
+  failure_type<std::error_code> f = try_operation_return_as(r);
+  BOOST_CHECK(f.error() == std::errc::invalid_argument);
+}
+
+namespace propagate_test
+{
+  // A user type implicitly constructible from any failure_type, as TRY has always supported
+  struct user_result
+  {
+    int value{0};
+    std::error_code error;
+    template <class EC, class P>
+    user_result(OUTCOME_V2_NAMESPACE::failure_type<EC, P> f)  // NOLINT
+        : error(f.error())
+    {
+    }
+    user_result(int v)  // NOLINT
+        : value(v)
+    {
+    }
+  };
+}  // namespace propagate_test
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / outcome / propagate_user_type, "Tests that TRY propagates into user types constructible from failure_type")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  using propagate_test::user_result;
+  auto source = [](int a) -> result<int> {
+    if(a < 0)
+    {
+      return std::make_error_code(std::errc::invalid_argument);
+    }
+    return a;
+  };
+  auto t1 = [&](int a) -> user_result {
+    OUTCOME_TRY(v, source(a));
+    return v + 1;
+  };
+  auto t2 = [&](int a) -> user_result {
+    outcome<int> o(source(a));
+    OUTCOME_TRY(v, o);
+    return v + 2;
+  };
+  BOOST_CHECK(t1(5).value == 6);
+  BOOST_CHECK(t1(-1).error == std::errc::invalid_argument);
+  BOOST_CHECK(t2(5).value == 7);
+  BOOST_CHECK(t2(-1).error == std::errc::invalid_argument);
+}
@@ -0,0 +1,127 @@
+/* Unit testing for outcomes
+(C) 2026 agent <agent@local> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/outcome.hpp"
+#include "quickcpplib/include/boost/test/unit_test.hpp"
+
+#include <map>
+#include <string>
+
+namespace reference_test
+{
+  struct base
+  {
+    int a{1};
+  };
+  struct derived : base
+  {
+  };
+  using index_type = std::map<int, std::string>;
+  inline OUTCOME_V2_NAMESPACE::result<const std::string &> lookup(const index_type &index, int key)
+  {
+    auto it = index.find(key);
+    if(it == index.end())
+    {
+      return std::errc::no_such_file_or_directory;
+    }
+    return it->second;
+  }
+}  // namespace reference_test
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / result / reference, "Tests that result works with lvalue reference value types")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  using namespace reference_test;
+  // References are stored as a pointer
+  static_assert(sizeof(result<int &>) == sizeof(result<int *>), "result<T &> is not the size of result<T *>");
+  static_assert(sizeof(result<std::string &, void>) == sizeof(result<std::string *, void>), "result<T &, void> is not the size of result<T *, void>");
+  static_assert(std::is_trivially_copyable<result<int &, void>>::value, "result<T &, void> is not trivially copyable");
+  static_assert(trait::is_trivially_relocatable<result<std::string &>>::value, "result<T &> is not trivially relocatable");
+  // Never bind to a temporary
+  static_assert(std::is_constructible<result<int &>, int &>::value, "");
+  static_assert(!std::is_constructible<result<int &>, int>::value, "");
+  static_assert(!std::is_constructible<result<const int &>, int>::value, "");
+  static_assert(!std::is_constructible<result<const int &>, long &>::value, "");
+  static_assert(!std::is_constructible<result<const int &>, in_place_type_t<const int &>, int>::value, "");
+  static_assert(!std::is_constructible<result<const int &>, result<int>>::value, "");
+  static_assert(std::is_constructible<result<const int &>, result<int &>>::value, "");
+  static_assert(std::is_constructible<result<base &>, derived &>::value, "");
+  static_assert(std::is_constructible<result<int>, result<int &>>::value, "");
+
+  index_type index{{1, "hello"}, {2, "world"}};
+  auto r = lookup(index, 1);
+  BOOST_CHECK(r);
+  BOOST_CHECK(&r.value() == &index[1]);
+  BOOST_CHECK(r.value() == "hello");
+  BOOST_CHECK(r == success(std::string("hello")));
+  auto m = lookup(index, 3);
+  BOOST_CHECK(!m);
+  BOOST_CHECK(m.error() == std::errc::no_such_file_or_directory);
+  BOOST_CHECK(r != m);
+
+  int x = 5, y = 6;
+  result<int &> a(x), b(in_place_type<int &>, y);
+  BOOST_CHECK(&a.value() == &x);
+  a.value() = 7;
+  BOOST_CHECK(x == 7);
+  // Reference collapsing means rvalue observers also return lvalue references
+  int &moved = std::move(a).value();
+  BOOST_CHECK(&moved == &x);
+  // Assignment rebinds rather than assigning through
+  a = b;
+  BOOST_CHECK(&a.value() == &y);
+  BOOST_CHECK(x == 7);
+  BOOST_CHECK(a == b);
+  result<const int &> c(b);
+  BOOST_CHECK(&c.value() == &y);
+  BOOST_CHECK(c == b);
+  result<int> d(a);
+  BOOST_CHECK(d.value() == 6);
+  BOOST_CHECK(d == a);
+  result<int &> g(x);
+  swap(a, g);
+  BOOST_CHECK(&a.value() == &x && &g.value() == &y);
+  derived z;
+  result<base &> e(z);
+  BOOST_CHECK(&e.value() == &z);
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / outcome / reference, "Tests that outcome works with lvalue reference value types")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  static_assert(sizeof(outcome<int &>) == sizeof(outcome<int *>), "outcome<T &> is not the size of outcome<T *>");
+  static_assert(!std::is_constructible<outcome<const int &>, int>::value, "");
+
+  int x = 5;
+  outcome<int &> a(x), b(std::errc::invalid_argument), c(std::exception_ptr{});
+  BOOST_CHECK(&a.value() == &x);
+  BOOST_CHECK(b.has_error());
+  BOOST_CHECK(c.has_exception());
+  outcome<const int &> d(a);
+  BOOST_CHECK(&d.value() == &x);
+  BOOST_CHECK(d == a);
+  result<int &> e(x);
+  outcome<int &> f(e);
+  BOOST_CHECK(&f.value() == &x);
+  BOOST_CHECK(f == e);
+}
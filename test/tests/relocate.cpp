@@ -0,0 +1,139 @@
+/* Unit testing for outcomes
+(C) 2026 agent <agent@local> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/relocate.hpp"
+#include "quickcpplib/include/boost/test/unit_test.hpp"
+
+#include <string>
+
+namespace relocate_test
+{
+  static int destructions;
+  // Owns heap memory through a plain pointer, so is safe to relocate with memcpy
+  struct owning_ptr
+  {
+    int *p{nullptr};
+    owning_ptr() = default;
+    explicit owning_ptr(int v)
+        : p(new int(v))
+    {
+    }
+    owning_ptr(owning_ptr &&o) noexcept : p(o.p) { o.p = nullptr; }
+    owning_ptr &operator=(owning_ptr &&o) noexcept
+    {
+      std::swap(p, o.p);
+      return *this;
+    }
+    ~owning_ptr()
+    {
+      ++destructions;
+      delete p;
+    }
+  };
+}  // namespace relocate_test
+
+namespace OUTCOME_V2_NAMESPACE
+{
+  namespace trait
+  {
+    template <> struct is_trivially_relocatable<relocate_test::owning_ptr> : std::true_type
+    {
+    };
+  }  // namespace trait
+}  // namespace OUTCOME_V2_NAMESPACE
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / outcome / relocate, "Tests that trivial relocatability propagates and relocate() works")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  using relocate_test::owning_ptr;
+  static_assert(trait::is_trivially_relocatable<void>::value, "");
+  static_assert(trait::is_trivially_relocatable<std::exception_ptr>::value, "");
+  static_assert(trait::is_trivially_relocatable<result<int>>::value, "");
+  static_assert(trait::is_trivially_relocatable<result<void>>::value, "");
+  static_assert(trait::is_trivially_relocatable<result<owning_ptr>>::value, "");
+  static_assert(trait::is_trivially_relocatable<outcome<int>>::value, "");
+  static_assert(trait::is_trivially_relocatable<outcome<owning_ptr>>::value, "");
+  static_assert(trait::is_trivially_relocatable_v<outcome<owning_ptr, owning_ptr, owning_ptr>>, "");
+  static_assert(!trait::is_trivially_relocatable<result<int, owning_ptr *, void>>::value == false, "");
+  static_assert(!trait::is_trivially_relocatable<outcome<int, std::error_code, std::string>>::value, "");
+  static_assert(!trait::is_trivially_relocatable<outcome<std::string>>::value, "");
+
+  {
+    alignas(result<owning_ptr>) char buffer1[8 * sizeof(result<owning_ptr>)], buffer2[8 * sizeof(result<owning_ptr>)];
+    auto *a = reinterpret_cast<result<owning_ptr> *>(buffer1), *b = reinterpret_cast<result<owning_ptr> *>(buffer2);
+    for(int n = 0; n < 8; n++)
+    {
+      if(n & 1)
+      {
+        new(a + n) result<owning_ptr>(std::make_error_code(std::errc::invalid_argument));
+      }
+      else
+      {
+        new(a + n) result<owning_ptr>(owning_ptr(n));
+      }
+    }
+    relocate_test::destructions = 0;
+    BOOST_CHECK(relocate(a, a + 8, b) == b + 8);
+    BOOST_CHECK(relocate_test::destructions == 0);  // bitwise, so no destructors ran
+    for(int n = 0; n < 8; n++)
+    {
+      if(n & 1)
+      {
+        BOOST_CHECK(b[n].has_error());
+      }
+      else
+      {
+        BOOST_CHECK(*b[n].value().p == n);
+      }
+      b[n].~result();
+    }
+  }
+  {
+    alignas(result<std::string>) char buffer1[8 * sizeof(result<std::string>)], buffer2[8 * sizeof(result<std::string>)];
+    auto *a = reinterpret_cast<result<std::string> *>(buffer1), *b = reinterpret_cast<result<std::string> *>(buffer2);
+    for(int n = 0; n < 8; n++)
+    {
+      if(n & 1)
+      {
+        new(a + n) result<std::string>(std::make_error_code(std::errc::invalid_argument));
+      }
+      else
+      {
+        new(a + n) result<std::string>(std::string(40, static_cast<char>('a' + n)));
+      }
+    }
+    BOOST_CHECK(relocate(a, a + 8, b) == b + 8);
+    for(int n = 0; n < 8; n++)
+    {
+      if(n & 1)
+      {
+        BOOST_CHECK(b[n].has_error());
+      }
+      else
+      {
+        BOOST_CHECK(b[n].value() == std::string(40, static_cast<char>('a' + n)));
+      }
+      b[n].~result();
+    }
+  }
+}
@@ -0,0 +1,210 @@
+/* Unit testing for outcomes
+(C) 2026 agent <agent@local> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/result_queue.hpp"
+#include "quickcpplib/include/boost/test/unit_test.hpp"
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / result_queue / single, "Tests that result queues keep values and errors in order")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  using queue_type = spsc_result_queue<std::string, std::error_code, 64, 4>;
+  auto q = std::make_unique<queue_type>();
+  queue_type::result_type r(std::errc::invalid_argument);
+  BOOST_CHECK(q->empty());
+  BOOST_CHECK(!q->pop(r));
+  // Runs of values separated by errors, wrapping around the ring several times
+  for(int lap = 0; lap < 5; lap++)
+  {
+    for(int n = 0; n < 50; n++)
+    {
+      if(n % 20 == 19)
+      {
+        BOOST_CHECK(q->push_error(std::make_error_code(std::errc::invalid_argument)));
+      }
+      else
+      {
+        BOOST_CHECK(q->push(queue_type::result_type(std::to_string(n))));
+      }
+    }
+    std::vector<std::string> drained;
+    BOOST_CHECK(q->drain_values([&](std::string &&v) { drained.push_back(std::move(v)); }) == 19);
+    BOOST_CHECK(drained.size() == 19 && drained[0] == "0" && drained[18] == "18");
+    BOOST_CHECK(q->drain_values([](std::string && /*unused*/) {}) == 0);
+    BOOST_CHECK(q->pop(r) && r.error() == std::errc::invalid_argument);
+    BOOST_CHECK(q->skip_values(5) == 5);
+    BOOST_CHECK(q->pop(r) && r.value() == "25");
+    BOOST_CHECK(q->skip_values() == 13);
+    BOOST_CHECK(q->pop(r) && r.has_error());
+    BOOST_CHECK(q->clear() == 10);
+    BOOST_CHECK(q->empty());
+  }
+  // Full value ring, and full error ring
+  for(int n = 0; n < 64; n++)
+  {
+    BOOST_CHECK(q->push_value("a"));
+  }
+  BOOST_CHECK(!q->push_value("a"));
+  BOOST_CHECK(q->skip_values() == 64);
+  for(int n = 0; n < 4; n++)
+  {
+    BOOST_CHECK(q->push_error(std::make_error_code(std::errc::invalid_argument)));
+  }
+  BOOST_CHECK(!q->push_error(std::make_error_code(std::errc::invalid_argument)));
+  BOOST_CHECK(q->push_value("a"));
+  BOOST_CHECK(q->skip_values() == 0);
+  BOOST_CHECK(q->clear() == 5);
+  // Leave values queued for the destructor
+  BOOST_CHECK(q->push_value("a"));
+}
+
+template <class Queue> static void run_threads(size_t producers, size_t per_producer)
+{
+  auto q = std::make_unique<Queue>();
+  std::vector<std::thread> threads;
+  for(size_t p = 0; p < producers; p++)
+  {
+    threads.emplace_back([&, p] {
+      for(size_t n = 0; n < per_producer; n++)
+      {
+        // Each value encodes its producer and sequence, errors carry the sequence
+        const bool error = (n % 13 == 0);
+        while(error ? !q->push_error(std::error_code(static_cast<int>(n), std::generic_category())) : !q->push_value(p << 32 | n))
+        {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  std::vector<size_t> next(producers);
+  size_t received = 0, errors = 0;
+  bool in_order = true;
+  typename Queue::result_type r(std::errc::invalid_argument);
+  while(received < producers * per_producer)
+  {
+    size_t drained = q->drain_values([&](size_t &&v) {
+      const size_t p = v >> 32, n = v & 0xffffffff;
+      if(n < next[p])
+      {
+        in_order = false;
+      }
+      next[p] = n + 1;
+    });
+    received += drained;
+    if(drained == 0)
+    {
+      if(q->pop(r))
+      {
+        ++received;
+        ++errors;
+        BOOST_CHECK(!r.has_value() && r.error().value() % 13 == 0);
+      }
+      else
+      {
+        std::this_thread::yield();
+      }
+    }
+  }
+  for(auto &t : threads)
+  {
+    t.join();
+  }
+  BOOST_CHECK(in_order);
+  BOOST_CHECK(errors == producers * ((per_producer + 12) / 13));
+  BOOST_CHECK(q->empty());
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / result_queue / threads, "Tests that result queues transfer results between threads")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  run_threads<spsc_result_queue<size_t, std::error_code, 256, 8>>(1, 100000);
+  run_threads<mpsc_result_queue<size_t, std::error_code, 256, 8>>(4, 25000);
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / result_queue / not_full, "Tests that pushing into a multiple producer result queue which is not full never fails")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  using queue_type = mpsc_result_queue<size_t, std::error_code, 256, 8>;
+  static constexpr size_t producers = 4, per_producer = 50000;
+  auto q = std::make_unique<queue_type>();
+  // Each producer keeps at most a quarter of each ring in flight, so the queue is never full
+  std::atomic<size_t> consumed_values[producers], consumed_errors[producers], failed(0);
+  for(size_t p = 0; p < producers; p++)
+  {
+    consumed_values[p] = 0;
+    consumed_errors[p] = 0;
+  }
+  std::vector<std::thread> threads;
+  for(size_t p = 0; p < producers; p++)
+  {
+    threads.emplace_back([&, p] {
+      size_t values = 0, errors = 0;
+      for(size_t n = 0; n < per_producer; n++)
+      {
+        const bool error = (n % 13 == 0);
+        while(values + errors - consumed_values[p] - consumed_errors[p] >= 256 / producers || (error && errors - consumed_errors[p] >= 8 / producers))
+        {
+          std::this_thread::yield();
+        }
+        if(error ? q->push_error(std::error_code(static_cast<int>(p), std::generic_category())) : q->push_value(size_t(p)))
+        {
+          ++(error ? errors : values);
+        }
+        else
+        {
+          ++failed;
+        }
+      }
+    });
+  }
+  size_t received = 0;
+  queue_type::result_type r(std::errc::invalid_argument);
+  while(received < producers * per_producer - failed)
+  {
+    size_t drained = q->drain_values([&](size_t &&p) { ++consumed_values[p]; });
+    received += drained;
+    if(drained == 0)
+    {
+      if(q->pop(r))
+      {
+        ++received;
+        ++consumed_errors[r.error().value()];
+      }
+      else
+      {
+        std::this_thread::yield();
+      }
+    }
+  }
+  for(auto &t : threads)
+  {
+    t.join();
+  }
+  BOOST_CHECK(failed == 0);
+  BOOST_CHECK(q->empty());
+}
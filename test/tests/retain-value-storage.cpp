@@ -0,0 +1,100 @@
+/* Unit testing for outcomes
+(C) 2026 agent <agent@local> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/iostream_support.hpp"
+#include "../../include/outcome/outcome.hpp"
+#include "quickcpplib/include/boost/test/unit_test.hpp"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace OUTCOME_V2_NAMESPACE
+{
+  namespace trait
+  {
+    template <class T> struct retain_value_storage<std::vector<T>> : std::true_type
+    {
+    };
+    template <> struct retain_value_storage<std::string> : std::true_type
+    {
+    };
+  }  // namespace trait
+}  // namespace OUTCOME_V2_NAMESPACE
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / result / retain_value_storage, "Tests that result can retain the capacity of its value across error transitions")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  using result_type = result<std::vector<int>>;
+  static_assert(std::is_same<std::decay_t<decltype(std::declval<result_type &>().__state())>, detail::value_storage_retaining<std::vector<int>>>::value, "");
+
+  result_type a(in_place_type<std::vector<int>>, {1, 2, 3});
+  a.value().reserve(100);
+  const int *buffer = a.value().data();
+  // Assignment of a failure clears the value rather than destroying it
+  a = result_type(std::errc::invalid_argument);
+  BOOST_CHECK(!a);
+  std::vector<int> &v = a.emplace_value();
+  BOOST_CHECK(a.has_value() && !a.has_error());
+  BOOST_CHECK(v.empty() && v.data() == buffer);
+  v.push_back(5);
+  a.emplace_error(std::make_error_code(std::errc::not_enough_memory));
+  BOOST_CHECK(a.error() == std::errc::not_enough_memory);
+  a.emplace_value(std::initializer_list<int>{4, 5});
+  BOOST_CHECK(a.value().size() == 2 && a.value().data() == buffer);
+  // Assignment of a value reuses my capacity too
+  const result_type b(in_place_type<std::vector<int>>, {6});
+  a = b;
+  BOOST_CHECK(a.value().size() == 1 && a.value().data() == buffer);
+  BOOST_CHECK(a == b);
+  a = result_type(std::errc::invalid_argument);
+  BOOST_CHECK(a == result_type(std::errc::invalid_argument));
+  result_type c(a);
+  BOOST_CHECK(c.error() == std::errc::invalid_argument);
+  swap(a, c);
+  BOOST_CHECK(c.emplace_value().data() == buffer);
+
+  // Conversion from non-retaining storage
+  result<std::string> d(result<const char *>("hello")), e(result<const char *>(std::errc::invalid_argument));
+  BOOST_CHECK(d.value() == "hello");
+  BOOST_CHECK(e.error() == std::errc::invalid_argument);
+
+  // Serialisation
+  std::stringstream s;
+  result<std::string, int> f("hello"), g(5);
+  s << f;
+  s >> g;
+  BOOST_CHECK(g.value() == "hello");
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / outcome / retain_value_storage, "Tests that outcome can retain the capacity of its value across error and exception transitions")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  using outcome_type = outcome<std::string>;
+  outcome_type a(std::string(100, 'a'));
+  const char *buffer = a.value().data();
+  a.emplace_exception();
+  BOOST_CHECK(a.has_exception());
+  a.emplace_error(std::make_error_code(std::errc::invalid_argument));
+  BOOST_CHECK(a.emplace_value("hello").data() == buffer);
+}
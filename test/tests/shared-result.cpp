@@ -0,0 +1,127 @@
+/* Unit testing for outcomes
+(C) 2026 agent <agent@local> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/shared_result.hpp"
+#include "quickcpplib/include/boost/test/unit_test.hpp"
+
+#ifndef _WIN32
+#include <sys/wait.h>
+
+namespace shared_result_test
+{
+  class custom_category_impl : public std::error_category
+  {
+  public:
+    const char *name() const noexcept override { return "custom"; }
+    std::string message(int /*unused*/) const override { return "custom"; }
+  };
+  inline const std::error_category &custom_category()
+  {
+    static custom_category_impl c;
+    return c;
+  }
+  struct big
+  {
+    char data[256];
+  };
+}  // namespace shared_result_test
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / shared_result / fork, "Tests that shared_result_array carries results from forked workers")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  static constexpr size_t slots = 64, workers = 4;
+  auto array = shared_result_array<double>::create(slots).value();
+  // The supervisor must know the categories its workers use
+  BOOST_CHECK(register_category(shared_result_test::custom_category()));
+  BOOST_CHECK(array.size() == slots);
+  pid_t pids[workers];
+  for(size_t w = 0; w < workers; w++)
+  {
+    pids[w] = ::fork();
+    if(pids[w] == 0)
+    {
+      for(size_t n = w; n < slots; n += workers)
+      {
+        switch(n % 8)
+        {
+        case 3:
+          array.set_error(n, std::error_code(static_cast<int>(n), std::system_category()));
+          break;
+        case 5:
+          array.set_error(n, std::make_error_code(std::errc::invalid_argument));
+          break;
+        case 7:
+          array.set_error(n, std::error_code(static_cast<int>(n), shared_result_test::custom_category()));
+          break;
+        default:
+          array.set_value(n, n * 1.5);
+        }
+      }
+      // Nobody may publish twice
+      ::_exit(array.set_value(w, 0) ? 1 : 0);
+    }
+  }
+  for(size_t n = 0; n < slots; n++)
+  {
+    auto r = array.wait(n);
+    switch(n % 8)
+    {
+    case 3:
+      BOOST_CHECK(r.error() == std::error_code(static_cast<int>(n), std::system_category()));
+      break;
+    case 5:
+      BOOST_CHECK(r.error() == std::errc::invalid_argument);
+      break;
+    case 7:
+      BOOST_CHECK(r.error() == std::error_code(static_cast<int>(n), shared_result_test::custom_category()));
+      break;
+    default:
+      BOOST_CHECK(r.value() == n * 1.5);
+    }
+  }
+  for(auto pid : pids)
+  {
+    int status = -1;
+    ::waitpid(pid, &status, 0);
+    BOOST_CHECK(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+  }
+
+  // Mapping from a file descriptor sees the same slots
+  auto other = shared_result_array<double>::open(array.fd()).value();
+  BOOST_CHECK(other.size() == slots && other.is_ready(0) && other.wait(1).value() == 1.5);
+  other.reset(0);
+  BOOST_CHECK(!array.is_ready(0));
+  BOOST_CHECK(array.set_value(0, 2.0));
+  BOOST_CHECK(other.wait(0).value() == 2.0);
+  // Which must be of the same type
+  BOOST_CHECK(shared_result_array<shared_result_test::big>::open(array.fd()).error() == std::errc::invalid_argument);
+  BOOST_CHECK(shared_result_array<double>::open(-1).error() == std::errc::bad_file_descriptor);
+
+  // Self move assignment keeps the mapping, and move assignment releases what was mapped before
+  auto &alias = other;
+  other = std::move(alias);
+  BOOST_CHECK(other.size() == slots && other.wait(0).value() == 2.0);
+  other = shared_result_array<double>::create(1).value();
+  BOOST_CHECK(other.size() == 1 && array.wait(0).value() == 2.0);
+}
+#endif
@@ -39,3 +39,71 @@ BOOST_OUTCOME_AUTO_TEST_CASE(works / outcome / swap, "Tests that the outcome swa
   BOOST_CHECK(a.value() == "niall");
   BOOST_CHECK(b.error() == std::errc::not_enough_memory);
 }
+
+namespace swap_test
+{
+  // Owns heap memory through a plain pointer, so is safe to relocate with memcpy
+  struct owning_ptr
+  {
+    int *p{nullptr};
+    owning_ptr() = default;
+    explicit owning_ptr(int v)
+        : p(new int(v))
+    {
+    }
+    owning_ptr(owning_ptr &&o) noexcept : p(o.p) { o.p = nullptr; }
+    owning_ptr &operator=(owning_ptr &&o) noexcept
+    {
+      std::swap(p, o.p);
+      return *this;
+    }
+    ~owning_ptr() { delete p; }
+  };
+}  // namespace swap_test
+
+namespace OUTCOME_V2_NAMESPACE
+{
+  namespace trait
+  {
+    template <> struct is_trivially_relocatable<swap_test::owning_ptr> : std::true_type
+    {
+    };
+  }  // namespace trait
+}  // namespace OUTCOME_V2_NAMESPACE
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / result / swap, "Tests that the result swaps and move assigns in every combination of states")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  using swap_test::owning_ptr;
+  {
+    result<owning_ptr> a(owning_ptr(1)), b(owning_ptr(2)), c(std::errc::not_enough_memory), d(std::errc::invalid_argument);
+    swap(a, b);
+    BOOST_CHECK(*a.value().p == 2);
+    BOOST_CHECK(*b.value().p == 1);
+    swap(a, c);
+    BOOST_CHECK(a.error() == std::errc::not_enough_memory);
+    BOOST_CHECK(*c.value().p == 2);
+    swap(a, d);
+    BOOST_CHECK(a.error() == std::errc::invalid_argument);
+    BOOST_CHECK(d.error() == std::errc::not_enough_memory);
+    a = std::move(b);
+    BOOST_CHECK(*a.value().p == 1);
+    b = std::move(d);
+    BOOST_CHECK(b.error() == std::errc::not_enough_memory);
+    a = std::move(a);
+    BOOST_CHECK(*a.value().p == 1);
+  }
+  {
+    result<std::string> a("niall"), b("douglas"), c(std::errc::not_enough_memory);
+    swap(a, c);
+    BOOST_CHECK(a.error() == std::errc::not_enough_memory);
+    BOOST_CHECK(c.value() == "niall");
+    swap(a, c);
+    BOOST_CHECK(a.value() == "niall");
+    BOOST_CHECK(c.error() == std::errc::not_enough_memory);
+    a = std::move(c);
+    BOOST_CHECK(a.error() == std::errc::not_enough_memory);
+    a = std::move(b);
+    BOOST_CHECK(a.value() == "douglas");
+  }
+}